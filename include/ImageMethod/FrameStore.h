@@ -0,0 +1,101 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <fstream>
+#include <functional>
+#include <cstdint>
+#include <cstddef>
+#include "MappedFile.h"
+
+// 打包帧文件：把一次焊接录制的图像（8 位灰度，尺寸相同）顺序存放在一个文件中，
+// 回放时内存映射后直接访问像素，不再逐帧解码 JPEG
+//
+// 文件布局（小端）：
+//   文件头  magic "WTFS" | uint16 版本 | uint16 保留 | uint32 宽 | uint32 高
+//           | uint32 每帧字节数 | uint32 保留 | uint64 帧数 | uint64 数据位置 | uint64 索引位置，补齐到 DataAlign
+//   帧数据  每帧 width * height 字节，行连续存放，帧间补齐到 FrameAlign（每帧字节数固定）
+//   索引    每帧时间戳 int64 (us)
+namespace FrameStore {
+    constexpr char Magic[4] = { 'W', 'T', 'F', 'S' };
+    constexpr uint16_t Version = 1;
+    constexpr size_t DataAlign = 4096;  // 帧数据起始位置按页对齐
+    constexpr size_t FrameAlign = 64;   // 每帧起始位置按缓存行对齐
+
+    // 解码函数：读取 file 为 8 位灰度图，失败返回 false
+    using FrameDecoder = std::function<bool(const std::string& file,
+        std::vector<uint8_t>& pixels, uint32_t& width, uint32_t& height)>;
+
+    // 列出目录下扩展名为 ext 的文件，按修改时间排序（时间相同按文件名）
+    // 每个文件只读取一次修改时间；目录不存在时返回空
+    std::vector<std::string> ListFrameFiles(const std::string& dir, const std::string& ext = ".jpg");
+
+    // 把图像文件依次解码后写入打包帧文件，时间戳为文件修改时间
+    // 解码失败或尺寸与第一帧不同的文件被跳过；没有可用帧时不创建文件
+    // 返回写入的帧数，输出文件无法创建时抛出 std::runtime_error
+    size_t Convert(const std::vector<std::string>& files, const std::string& FileName,
+        const FrameDecoder& decode);
+}
+
+// 单帧视图：指向映射内存，读取对象存在期间有效
+struct FrameView {
+    const uint8_t* data = nullptr;  // width * height 字节，行连续
+    uint32_t width = 0;
+    uint32_t height = 0;
+    int64_t timeUs = 0;
+};
+
+// 打包帧文件写入
+class FrameStoreWriter {
+public:
+    // FileName 无法创建时抛出 std::runtime_error，尺寸为 0 时抛出 std::invalid_argument
+    FrameStoreWriter(const std::string& FileName, uint32_t width, uint32_t height);
+    ~FrameStoreWriter();
+
+    FrameStoreWriter(const FrameStoreWriter&) = delete;
+    FrameStoreWriter& operator=(const FrameStoreWriter&) = delete;
+
+    // 追加一帧，srcStride 为源图像每行字节数（0 表示等于宽度）
+    void Append(const uint8_t* pixels, int64_t timeUs, size_t srcStride = 0);
+
+    // 写出索引并回填文件头
+    void Close();
+
+    uint32_t Width() const { return width_; }
+    uint32_t Height() const { return height_; }
+    uint64_t Frames() const { return frames_; }
+
+private:
+    std::ofstream file_;
+    uint32_t width_;
+    uint32_t height_;
+    size_t frameBytes_;
+    std::vector<char> frame_;           // 当前帧（含补齐）
+    std::vector<int64_t> times_;
+    uint64_t frames_ = 0;
+    bool closed_ = false;
+};
+
+// 打包帧文件读取（内存映射），帧访问零拷贝，可在多个线程间共享
+class FrameStoreReader {
+public:
+    // FileName 无法映射或格式错误时抛出 std::runtime_error
+    explicit FrameStoreReader(const std::string& FileName);
+
+    uint32_t Width() const { return width_; }
+    uint32_t Height() const { return height_; }
+    size_t FrameBytes() const { return frameBytes_; }
+    size_t Frames() const { return frames_; }
+
+    // 第 i 帧，越界时抛出 std::out_of_range
+    FrameView Frame(size_t i) const;
+
+private:
+    WeldTrackApp::MappedFile file_;
+    uint32_t width_ = 0;
+    uint32_t height_ = 0;
+    size_t frameBytes_ = 0;
+    size_t frames_ = 0;
+    const char* data_ = nullptr;
+    const char* index_ = nullptr;
+};
@@ -10,11 +10,12 @@
 #include <chrono>
 #include <cstring>
 #include <fstream>
+#include "ImageMethod/FrameStore.h"
 
-// Halcon ͷļ
+// Halcon 头文件
 #include "HalconCpp.h"
 
-// Pylon  SDK ͷļ
+// Pylon 相机 SDK 头文件
 #include <pylon/PylonIncludes.h>
 
 namespace fs = std::filesystem;
@@ -23,41 +24,41 @@ using namespace Pylon;
 
 class HGetImage {
 public:
-    // 
+    // 单例访问
     static HGetImage& GetInstance() {
         static HGetImage instance;
         return instance;
     }
 
-    // ֹ͸ֵ
+    // 禁止拷贝和赋值
     HGetImage(const HGetImage&) = delete;
     HGetImage& operator=(const HGetImage&) = delete;
 
-    // 
+    // 打开相机
     bool Open() {
         std::lock_guard<std::mutex> lock(camera_mutex_);
 
         try {
             if (camera_) {
-                return true; // Ѵ
+                return true; // 相机已打开
             }
 
-            // 
+            // 创建相机对象
             camera_ = std::make_unique<CInstantCamera>(CTlFactory::GetInstance().CreateFirstDevice());
 
-            // ע¼
+            // 注册配置事件
             camera_->RegisterConfiguration(new CAcquireContinuousConfiguration, RegistrationMode_ReplaceAll, Cleanup_Delete);
 
-            // ò
+            // 设置参数
             camera_->MaxNumBuffer = 5;
 
-            // עͼץȡص
+            // 注册图像抓取回调
             camera_->RegisterImageEventHandler(this, RegistrationMode_Append, Cleanup_None);
 
-            // 
+            // 打开相机
             camera_->Open();
 
-            // ʼץȡ
+            // 开始抓取
             camera_->StartGrabbing(GrabStrategy_OneByOne, GrabLoop_ProvidedByInstantCamera);
 
             return true;
@@ -69,7 +70,7 @@ public:
         }
     }
 
-    // ֹͣ
+    // 停止相机
     void Stop() {
         std::lock_guard<std::mutex> lock(camera_mutex_);
 
@@ -83,11 +84,11 @@ public:
             camera_.reset();
         }
         catch (...) {
-            // ֹͣеĴ
+            // 忽略停止过程中的错误
         }
     }
 
-    // ȡǰͼ
+    // 获取当前图像
     HImage GetImage(bool save_image = false) {
         std::lock_guard<std::mutex> lock(image_mutex_);
 
@@ -98,10 +99,27 @@ public:
         return current_image_;
     }
 
-    // ļȡͼ񣨲ã
+    // 从文件获取图像（测试用）
+    // 已打开打包帧文件时从映射内存复制像素（不解码），否则逐帧解码 JPEG
     HImage GetImageFromFile() {
         std::lock_guard<std::mutex> lock(file_mutex_);
 
+        if (frame_store_) {
+            if (frame_num_ < frame_store_->Frames()) {
+                try {
+                    // 复制一次：映射为只读，且返回的图像不应依赖帧文件的生命周期
+                    FrameView view = frame_store_->Frame(frame_num_);
+                    current_image_.GenImage1("byte", view.width, view.height,
+                        const_cast<uint8_t*>(view.data));
+                    frame_num_++;
+                }
+                catch (HException& e) {
+                    last_error_ = e.ErrorMessage().Text();
+                }
+            }
+            return current_image_;
+        }
+
         if (track_files_.empty()) {
             LoadImageFiles();
         }
@@ -119,12 +137,60 @@ public:
         return current_image_;
     }
 
-    // ȡϢ
+    // 打开打包帧文件用于回放，之后 GetImageFromFile 从第一帧开始
+    bool OpenFrameStore(const std::string& store_file) {
+        std::lock_guard<std::mutex> lock(file_mutex_);
+
+        try {
+            frame_store_ = std::make_unique<FrameStoreReader>(store_file);
+            frame_num_ = 0;
+            return true;
+        }
+        catch (const std::exception& e) {
+            last_error_ = e.what();
+            frame_store_.reset();
+            return false;
+        }
+    }
+
+    // 把 JPEG 目录转换为打包帧文件（彩色图转为灰度），返回转换的帧数
+    size_t ConvertImageDir(const std::string& image_dir, const std::string& store_file) {
+        try {
+            return FrameStore::Convert(FrameStore::ListFrameFiles(image_dir, ".jpg"), store_file,
+                [](const std::string& file, std::vector<uint8_t>& pixels, uint32_t& width, uint32_t& height) {
+                    try {
+                        HImage image(file.c_str());
+                        if (image.CountChannels().I() > 1) {
+                            image = image.Rgb1ToGray();
+                        }
+                        HString type;
+                        Hlong w = 0, h = 0;
+                        const uint8_t* data = static_cast<const uint8_t*>(image.GetImagePointer1(&type, &w, &h));
+                        if (type != "byte") {
+                            return false;
+                        }
+                        width = static_cast<uint32_t>(w);
+                        height = static_cast<uint32_t>(h);
+                        pixels.assign(data, data + static_cast<size_t>(w) * h);
+                        return true;
+                    }
+                    catch (HException&) {
+                        return false;
+                    }
+                });
+        }
+        catch (const std::exception& e) {
+            last_error_ = e.what();
+            return 0;
+        }
+    }
+
+    // 获取最后错误信息
     std::string GetLastError() const {
         return last_error_;
     }
 
-    // Pylon ͼ¼ӿ
+    // Pylon 图像事件处理接口
     void OnImageGrabbed(CInstantCamera& camera, const CGrabResultPtr& grabResult) {
         if (!grabResult->GrabSucceeded()) {
             last_error_ = "Image grab failed";
@@ -132,15 +198,15 @@ public:
         }
 
         try {
-            // ͼ񻥳
+            // 锁定图像互斥锁
             std::lock_guard<std::mutex> lock(image_mutex_);
 
-            // Halconͼ
+            // 创建Halcon图像
             const uint8_t* buffer = static_cast<const uint8_t*>(grabResult->GetBuffer());
             int width = static_cast<int>(grabResult->GetWidth());
             int height = static_cast<int>(grabResult->GetHeight());
 
-            // ͼ
+            // 创建新图像对象
             current_image_.GenImage1("byte", width, height, const_cast<HBYTE*>(buffer));
         }
         catch (HException& e) {
@@ -149,13 +215,13 @@ public:
     }
 
 private:
-    // ˽й캯ģʽ
+    // 私有构造函数（单例模式）
     HGetImage()
         : frame_path_("E:/yan/WeldTrackApp_lcy/test-L/"),
         frame_num_(0),
         if_save_(false) {
         try {
-            // ͼ
+            // 创建空图像
             current_image_.GenImageConst("byte", 1, 1);
         }
         catch (HException& e) {
@@ -163,19 +229,19 @@ private:
         }
     }
 
-    // 浱ǰͼ
+    // 保存当前图像
     void SaveCurrentImage() {
         try {
-            // ȷĿ¼
+            // 确保目录存在
             fs::create_directories(frame_path_);
 
-            // ļ
+            // 生成文件名
             std::string filename = frame_path_ + std::to_string(frame_num_) + ".jpg";
 
-            // ͼ
+            // 保存图像
             current_image_.WriteImage("jpeg", 0, filename.c_str());
 
-            // ֡
+            // 增加帧计数
             frame_num_++;
         }
         catch (const std::exception& e) {
@@ -183,7 +249,7 @@ private:
         }
     }
 
-    // ͼļб
+    // 加载图像文件列表
     void LoadImageFiles() {
         try {
             std::string test_path = "E:/yan/WeldTrackApp_lcy/test_3/";
@@ -193,18 +259,8 @@ private:
                 return;
             }
 
-            // ռJPGļ
-            for (const auto& entry : fs::directory_iterator(test_path)) {
-                if (entry.path().extension() == ".jpg") {
-                    track_files_.push_back(entry.path().string());
-                }
-            }
-
-            // ޸ʱ
-            std::sort(track_files_.begin(), track_files_.end(),
-                [](const std::string& a, const std::string& b) {
-                    return fs::last_write_time(a) < fs::last_write_time(b);
-                });
+            // 收集所有JPG文件，按修改时间排序
+            track_files_ = FrameStore::ListFrameFiles(test_path, ".jpg");
         }
         catch (const std::exception& e) {
             last_error_ = e.what();
@@ -212,22 +268,23 @@ private:
     }
 
 private:
-    // 
+    // 相机对象
     std::unique_ptr<CInstantCamera> camera_;
 
-    // ǰͼ
+    // 当前图像
     HImage current_image_;
 
-    // ļ·
+    // 文件路径
     std::string frame_path_;
     std::vector<std::string> track_files_;
+    std::unique_ptr<FrameStoreReader> frame_store_;
 
-    // ״̬
+    // 状态变量
     int frame_num_;
     bool if_save_;
     std::string last_error_;
 
-    // 
+    // 互斥锁
     std::mutex camera_mutex_;
     std::mutex image_mutex_;
     std::mutex file_mutex_;
@@ -1,4 +1,4 @@
-// ֹ캯ʵ
+// 三种构造函数实现
 template <typename T>
 Matrix<T>::Matrix(const std::vector<std::vector<T>>& value)
     : numRows(value.size()), numColumns(value.empty() ? 0 : value[0].size())
@@ -29,38 +29,38 @@ Matrix<T>::Matrix(int nSize, const std::vector<T>& value)
     elements = value;
 }
 
-// ƶ캯
+// 移动构造函数
 template <typename T>
 Matrix<T>::Matrix(Matrix&& other) noexcept
-    : numRows(other.numRows),          // ֱת
-    numColumns(other.numColumns),    // ֱת
-    elements(std::move(other.elements))  // ʹ std::move ת vector
+    : numRows(other.numRows),          // 直接转移行数
+    numColumns(other.numColumns),    // 直接转移列数
+    elements(std::move(other.elements))  // 使用 std::move 转移 vector
 {
-    // ÿԴ״̬
+    // 置空源对象的状态
     other.numRows = 0;
     other.numColumns = 0;
-    // ע⣺other.elements ѾƶԶΪ vector
+    // 注意：other.elements 已经被移动，自动变为空 vector
 }
-// ƶֵ
+// 移动赋值运算符
 template <typename T>
 Matrix<T>& Matrix<T>::operator=(Matrix&& other) noexcept {
     if (this != &other) {
-        // ҪֶͷԴvector Զ
+        // 不需要手动释放资源！vector 会自动管理
 
-        // תԴ
+        // 转移资源
         numRows = other.numRows;
         numColumns = other.numColumns;
-        elements = std::move(other.elements);  // ʹ std::move
+        elements = std::move(other.elements);  // 使用 std::move
 
-        // ÿԴ
+        // 置空源对象
         other.numRows = 0;
         other.numColumns = 0;
-        // other.elements ѱƶԶΪ
+        // other.elements 已被移动，自动为空
     }
     return *this;
 }
 
-// Ԫط
+// 元素访问
 template <typename T>
 T& Matrix<T>::operator()(int row, int col) {
     if (row < 0 || row >= numRows || col < 0 || col >= numColumns) {
@@ -77,7 +77,7 @@ const T& Matrix<T>::operator()(int row, int col) const {
     return elements[col + row * numColumns];
 }
 
-// 
+// 矩阵运算
 template <typename T>
 Matrix<T> Matrix<T>::operator+(const Matrix& other) const {
     if (numColumns != other.numColumns || numRows != other.numRows) {
@@ -136,7 +136,7 @@ Matrix<T> Matrix<T>::operator*(T value) const {
     return result;
 }
 
-// 
+// 矩阵操作
 template <typename T>
 void Matrix<T>::Init(int nRows, int nCols) {
     if (nRows < 0 || nCols < 0) {
@@ -146,7 +146,7 @@ void Matrix<T>::Init(int nRows, int nCols) {
     numRows = nRows;
     numColumns = nCols;
     elements.resize(nRows * nCols);
-    std::fill(elements.begin(), elements.end(), T{});   // һʲô˼ôڴ
+    std::fill(elements.begin(), elements.end(), T{});   // 这一行是什么意思？怎么管理内存
 }
 
 template <typename T>
@@ -154,7 +154,7 @@ void Matrix<T>::SetData(const std::vector<T>& data) {
     if (static_cast<int>(data.size()) != numRows * numColumns) {
         throw std::invalid_argument("Input data size does not match matrix dimensions");
     }
-    //elements = data;    // Դ (double[])value.Clone() ƺûдڴelements
+    //elements = data;    // 源代码 (double[])value.Clone() 这里似乎没有创建新内存给elements
     elements.assign(data.begin(), data.end());
 }
 
@@ -177,7 +177,7 @@ T Matrix<T>::GetElement(int row, int col) const {
 
 template <typename T>
 bool Matrix<T>::MakeUnitMatrix(int nSize) {
-    //if (!Init(nSize, nSize)) {      // C++Initvoid
+    //if (!Init(nSize, nSize)) {      // C++的Init函数声明是void
     //    return false;
     //}
     Init(nSize, nSize);
@@ -196,11 +196,11 @@ Matrix<T> Matrix<T>::Transpose() const {
             trans(j, i) = (*this)(i, j);
         }
     }
-    return trans;   // ιڴ棿ɵMatrixɾڴ
+    return trans;   // 这里如何管理内存？旧的Matrix不删除内存吗？
 }
 
 
-// Դ
+// 线性代数运算
 template <typename T>
 bool Matrix<T>::InvertGaussJordan() {
     if (numRows != numColumns) {
@@ -272,7 +272,7 @@ bool Matrix<T>::InvertGaussJordan() {
     return true;
 }
 
-// ʽ (˹Ԫ) -> δУԴ
+// 行列式计算 (高斯消元法) -> 未校对代码
 template <typename T>
 T Matrix<T>::ComputeDetGauss() const {
     if (numRows != numColumns) {
@@ -284,7 +284,7 @@ T Matrix<T>::ComputeDetGauss() const {
     T det = 1.0;
 
     for (int k = 0; k < n - 1; k++) {
-        // Ԫѡ
+        // 部分主元选择
         int maxRow = k;
         T maxVal = std::abs(temp(k, k));
         for (int i = k + 1; i < n; i++) {
@@ -298,14 +298,14 @@ T Matrix<T>::ComputeDetGauss() const {
         if (maxVal == 0.0) return 0.0;
 
         if (maxRow != k) {
-            // 
+            // 交换行
             for (int j = k; j < n; j++) {
                 std::swap(temp(k, j), temp(maxRow, j));
             }
-            det = -det; // нıʽ
+            det = -det; // 行交换改变行列式符号
         }
 
-        // ˹Ԫ
+        // 高斯消元
         for (int i = k + 1; i < n; i++) {
             T factor = temp(i, k) / temp(k, k);
             for (int j = k + 1; j < n; j++) {
@@ -320,7 +320,7 @@ T Matrix<T>::ComputeDetGauss() const {
     return det;
 }
 
-// ַʾ
+// 字符串表示
 template <typename T>
 std::string Matrix<T>::ToString() const {
     return ToString(",", true);
@@ -372,7 +372,7 @@ std::string Matrix<T>::ToStringCol(int nCol, const std::string& sDelim) const {
     return oss.str();
 }
 
-// ڲ
+// 内部辅助函数
 template <typename T>
 void Matrix<T>::ppp(std::vector<T>& a, const std::vector<T>& e, const std::vector<T>& s,
     std::vector<T>& v, int m, int n) const
@@ -0,0 +1,132 @@
+#pragma once
+
+#include <string>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+namespace WeldTrackApp {
+
+    /// @brief 只读内存映射文件
+    /// 打开时只建立映射，不读取文件内容，数据在首次访问时由操作系统按页调入；
+    /// 适用于按需访问大文件。映射随对象析构解除，只可移动不可拷贝。
+    class MappedFile {
+    public:
+        MappedFile() = default;
+
+        /// @brief 映射文件
+        /// @param path 文件路径，打开或映射失败时抛出 std::runtime_error
+        explicit MappedFile(const std::string& path) { Open(path); }
+
+        ~MappedFile() { Close(); }
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        MappedFile(MappedFile&& other) noexcept { Swap(other); }
+        MappedFile& operator=(MappedFile&& other) noexcept
+        {
+            if (this != &other) {
+                Close();
+                Swap(other);
+            }
+            return *this;
+        }
+
+        /// @brief 映射文件，已映射的文件先解除
+        void Open(const std::string& path)
+        {
+            Close();
+#ifdef _WIN32
+            HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+            if (file == INVALID_HANDLE_VALUE) {
+                throw std::runtime_error("Error opening file: " + path);
+            }
+            LARGE_INTEGER size;
+            if (!GetFileSizeEx(file, &size)) {
+                CloseHandle(file);
+                throw std::runtime_error("Error reading file size: " + path);
+            }
+            size_ = static_cast<size_t>(size.QuadPart);
+            if (size_ > 0) {
+                HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+                if (mapping != nullptr) {
+                    data_ = static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+                    CloseHandle(mapping);  // 视图保持映射有效
+                }
+            }
+            CloseHandle(file);
+#else
+            int fd = ::open(path.c_str(), O_RDONLY);
+            if (fd < 0) {
+                throw std::runtime_error("Error opening file: " + path);
+            }
+            struct stat st;
+            if (::fstat(fd, &st) != 0) {
+                ::close(fd);
+                throw std::runtime_error("Error reading file size: " + path);
+            }
+            size_ = static_cast<size_t>(st.st_size);
+            if (size_ > 0) {
+                void* addr = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+                data_ = (addr == MAP_FAILED) ? nullptr : static_cast<const char*>(addr);
+            }
+            ::close(fd);  // 映射保持有效
+#endif
+            if (size_ > 0 && data_ == nullptr) {
+                size_ = 0;
+                throw std::runtime_error("Error mapping file: " + path);
+            }
+            open_ = true;
+        }
+
+        /// @brief 解除映射
+        void Close()
+        {
+            if (data_ != nullptr) {
+#ifdef _WIN32
+                UnmapViewOfFile(data_);
+#else
+                ::munmap(const_cast<char*>(data_), size_);
+#endif
+            }
+            data_ = nullptr;
+            size_ = 0;
+            open_ = false;
+        }
+
+        bool IsOpen() const { return open_; }
+
+        /// @brief 映射起始地址（页对齐），空文件为 nullptr
+        const char* Data() const { return data_; }
+
+        /// @brief 文件大小（字节）
+        size_t Size() const { return size_; }
+
+    private:
+        const char* data_ = nullptr;
+        size_t size_ = 0;
+        bool open_ = false;
+
+        void Swap(MappedFile& other) noexcept
+        {
+            std::swap(data_, other.data_);
+            std::swap(size_, other.size_);
+            std::swap(open_, other.open_);
+        }
+    };
+
+} // namespace WeldTrackApp
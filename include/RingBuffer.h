@@ -0,0 +1,102 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+
+namespace WeldTrackApp {
+
+    /// @brief 定容环形缓冲区
+    /// 存储空间随对象一次分配，压入/弹出均为 O(1)，不发生内存重分配与历史数据搬移。
+    /// 下标 0 为最早压入的元素。
+    template <typename T, size_t N>
+    class RingBuffer {
+        static_assert(N > 0, "RingBuffer capacity must be bigger than 0");
+
+    public:
+        /// @brief 容量
+        static constexpr size_t Capacity() { return N; }
+
+        size_t Size() const { return size_; }
+        bool Empty() const { return size_ == 0; }
+        bool Full() const { return size_ == N; }
+
+        /// @brief 在尾部压入元素
+        /// @return 缓冲区已满时不压入并返回 false
+        bool Push(const T& value)
+        {
+            if (size_ == N) {
+                return false;
+            }
+            data_[(head_ + size_) % N] = value;
+            ++size_;
+            return true;
+        }
+
+        /// @brief 在尾部压入元素，缓冲区已满时覆盖最早的元素
+        void PushOverwrite(const T& value)
+        {
+            if (size_ == N) {
+                data_[head_] = value;
+                head_ = (head_ + 1) % N;
+            }
+            else {
+                data_[(head_ + size_) % N] = value;
+                ++size_;
+            }
+        }
+
+        /// @brief 弹出最早的元素
+        void PopFront()
+        {
+            if (size_ == 0) {
+                throw std::out_of_range("RingBuffer is empty");
+            }
+            head_ = (head_ + 1) % N;
+            --size_;
+        }
+
+        /// @brief 弹出最早的 count 个元素
+        void PopFront(size_t count)
+        {
+            if (count > size_) {
+                throw std::out_of_range("RingBuffer pop count out of range");
+            }
+            head_ = (head_ + count) % N;
+            size_ -= count;
+        }
+
+        T& Front() { return (*this)[0]; }
+        const T& Front() const { return (*this)[0]; }
+        T& Back() { return (*this)[size_ - 1]; }
+        const T& Back() const { return (*this)[size_ - 1]; }
+
+        T& operator[](size_t i)
+        {
+            if (i >= size_) {
+                throw std::out_of_range("RingBuffer index out of range");
+            }
+            return data_[(head_ + i) % N];
+        }
+
+        const T& operator[](size_t i) const
+        {
+            if (i >= size_) {
+                throw std::out_of_range("RingBuffer index out of range");
+            }
+            return data_[(head_ + i) % N];
+        }
+
+        void Clear()
+        {
+            head_ = 0;
+            size_ = 0;
+        }
+
+    private:
+        std::array<T, N> data_ = {};
+        size_t head_ = 0;
+        size_t size_ = 0;
+    };
+
+} // namespace WeldTrackApp
@@ -0,0 +1,148 @@
+#pragma once
+
+#include <vector>
+#include <array>
+#include <tuple>
+#include <cstddef>
+#include <utility>
+#include <type_traits>
+#include "WTrackDType.h"
+#include "RobotMethod/SortedWindow.h"
+#include "RobotMethod/SeamKalmanTracker.h"
+
+namespace WeldTrackApp {
+
+    /// @brief 标量滤波策略
+    /// 每个策略提供 double Update(double) 与 void Reset()，参数在构造时给定，状态为定长成员，
+    /// 由 FilterChain 在编译期串联，调用全部内联，无虚函数与堆分配。
+    namespace FilterPolicy {
+
+        /// @brief 滑动中位数，N 为窗口长度
+        template <size_t N>
+        class Median {
+            static_assert(N > 0, "Median window must be bigger than 0");
+
+        public:
+            double Update(double x);
+            void Reset();
+
+        private:
+            SortedWindow<N> window_;
+        };
+
+        /// @brief 指数滑动平均 y = (1 - alpha) * y + alpha * x（与 ContinuityFilter 相同），首个样本原样输出
+        class EMA {
+        public:
+            /// @param alpha 滤波系数 (0, 1]
+            explicit EMA(double alpha = 0.46);
+            double Update(double x);
+            void Reset();
+
+        private:
+            double alpha_;
+            double y_ = 0.0;
+            bool init_ = false;
+        };
+
+        /// @brief 卡尔曼模型标签：随机游走（与 Cal_KalmanFilter 相同）
+        struct RW {};
+        /// @brief 卡尔曼模型标签：匀速（与 SeamCVTracker 单轴相同）
+        struct CV {};
+
+        template <typename Model>
+        class Kalman;
+
+        /// @brief 随机游走模型标量卡尔曼滤波
+        template <>
+        class Kalman<RW> {
+        public:
+            /// @param MNoiseCov 测量噪声协方差
+            /// @param PNoiseCov 过程噪声协方差
+            explicit Kalman(double MNoiseCov = 0.1, double PNoiseCov = 0.01);
+            double Update(double x);
+            void Reset();
+
+        private:
+            double r_;
+            double q_;
+            double x_ = 0.0;
+            double p_ = MacroDefine::KalmanInitCov;
+            bool init_ = false;
+        };
+
+        /// @brief 匀速模型卡尔曼滤波，状态 [p, v]（即 SeamCVTracker 的单轴 SeamAxisKalman<2>）
+        template <>
+        class Kalman<CV> {
+        public:
+            /// @param dt 测量周期 (s)
+            /// @param PNoiseCov 加速度噪声谱密度
+            /// @param MNoiseCov 测量噪声协方差 (mm^2)
+            explicit Kalman(double dt = MacroDefine::InterCycle, double PNoiseCov = 10.0, double MNoiseCov = 0.01);
+            double Update(double x);
+            void Reset();
+
+            /// @brief 当前速度估计
+            double Velocity() const { return axis_.GetState()[1]; }
+
+        private:
+            SeamAxisKalman<2> axis_;
+        };
+
+    } // namespace FilterPolicy
+
+    /// @brief 编译期串联的标量滤波链，例如 FilterChain<Median<5>, Kalman<CV>, EMA>
+    /// 输入依次经过各级策略，空链原样输出。
+    template <typename... Stages>
+    class FilterChain {
+    public:
+        FilterChain() = default;
+
+        /// @brief 以给定参数的各级策略构造（空链仅有默认构造）
+        template <size_t M = sizeof...(Stages), typename = std::enable_if_t<(M > 0)>>
+        explicit FilterChain(Stages... stages) : stages_(std::move(stages)...) {}
+
+        double Update(double x);
+        void Reset();
+
+        /// @brief 第 I 级策略
+        template <size_t I>
+        auto& Stage() { return std::get<I>(stages_); }
+
+        static constexpr size_t StageNum = sizeof...(Stages);
+
+    private:
+        std::tuple<Stages...> stages_;
+
+        template <size_t... I>
+        double UpdateImpl(double x, std::index_sequence<I...>);
+    };
+
+    /// @brief x / y / z 三轴分别配置的滤波链
+    template <typename ChainX, typename ChainY = ChainX, typename ChainZ = ChainY>
+    class AxisFilter {
+    public:
+        AxisFilter() = default;
+        AxisFilter(ChainX x, ChainY y, ChainZ z)
+            : x_(std::move(x)), y_(std::move(y)), z_(std::move(z)) {}
+
+        /// @brief 输入一个测量点
+        /// @param pt 测量点 [x, y, z, ...]
+        /// @return 滤波后的点 [x, y, z]
+        std::vector<double> Update(const std::vector<double>& pt);
+
+        void Reset();
+
+        ChainX& X() { return x_; }
+        ChainY& Y() { return y_; }
+        ChainZ& Z() { return z_; }
+
+    private:
+        ChainX x_;
+        ChainY y_;
+        ChainZ z_;
+    };
+
+} // namespace WeldTrackApp
+
+// 实现模板类必须在头文件中
+#include "FilterChain.inl"
@@ -0,0 +1,128 @@
+#include <stdexcept>
+
+namespace WeldTrackApp {
+
+    namespace FilterPolicy {
+
+        template <size_t N>
+        double Median<N>::Update(double x)
+        {
+            window_.Push(x);
+            return window_.Median();
+        }
+
+        template <size_t N>
+        void Median<N>::Reset()
+        {
+            window_.Clear();
+        }
+
+        inline EMA::EMA(double alpha)
+            : alpha_(alpha)
+        {
+            if (alpha <= 0.0 || alpha > 1.0) {
+                throw std::invalid_argument("EMA alpha must be in (0, 1]");
+            }
+        }
+
+        inline double EMA::Update(double x)
+        {
+            if (!init_) {
+                y_ = x;
+                init_ = true;
+            }
+            else {
+                y_ = (1 - alpha_) * y_ + alpha_ * x;
+            }
+            return y_;
+        }
+
+        inline void EMA::Reset()
+        {
+            init_ = false;
+        }
+
+        inline Kalman<RW>::Kalman(double MNoiseCov, double PNoiseCov)
+            : r_(MNoiseCov), q_(PNoiseCov)
+        {
+            if (MNoiseCov <= 0.0 || PNoiseCov < 0.0) {
+                throw std::invalid_argument("noise covariance must be positive");
+            }
+        }
+
+        // 与 Cal_KalmanFilter 相同的递推，逐点输出
+        inline double Kalman<RW>::Update(double x)
+        {
+            if (!init_) {
+                x_ = x;
+                p_ = MacroDefine::KalmanInitCov;
+                init_ = true;
+                return x_;
+            }
+            p_ += q_;
+            const double gain = p_ / (p_ + r_);
+            x_ += gain * (x - x_);
+            p_ = (1.0 - gain) * p_;
+            return x_;
+        }
+
+        inline void Kalman<RW>::Reset()
+        {
+            init_ = false;
+        }
+
+        inline Kalman<CV>::Kalman(double dt, double PNoiseCov, double MNoiseCov)
+            : axis_(dt, PNoiseCov, MNoiseCov)
+        {
+        }
+
+        inline double Kalman<CV>::Update(double x)
+        {
+            return axis_.Update(x);
+        }
+
+        inline void Kalman<CV>::Reset()
+        {
+            axis_.Reset();
+        }
+
+    } // namespace FilterPolicy
+
+    template <typename... Stages>
+    double FilterChain<Stages...>::Update(double x)
+    {
+        return UpdateImpl(x, std::index_sequence_for<Stages...>{});
+    }
+
+    template <typename... Stages>
+    template <size_t... I>
+    double FilterChain<Stages...>::UpdateImpl(double x, std::index_sequence<I...>)
+    {
+        ((x = std::get<I>(stages_).Update(x)), ...);
+        return x;
+    }
+
+    template <typename... Stages>
+    void FilterChain<Stages...>::Reset()
+    {
+        std::apply([](auto&... stage) { (stage.Reset(), ...); }, stages_);
+    }
+
+    template <typename ChainX, typename ChainY, typename ChainZ>
+    std::vector<double> AxisFilter<ChainX, ChainY, ChainZ>::Update(const std::vector<double>& pt)
+    {
+        if (pt.size() < 3) {
+            throw std::invalid_argument("input point must be 3 - dimensional");
+        }
+        return { x_.Update(pt[0]), y_.Update(pt[1]), z_.Update(pt[2]) };
+    }
+
+    template <typename ChainX, typename ChainY, typename ChainZ>
+    void AxisFilter<ChainX, ChainY, ChainZ>::Reset()
+    {
+        x_.Reset();
+        y_.Reset();
+        z_.Reset();
+    }
+
+} // namespace WeldTrackApp
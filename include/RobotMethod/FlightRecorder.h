@@ -0,0 +1,139 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstddef>
+#include "WTrackDType.h"
+
+namespace WeldTrackApp {
+
+    /// @brief 飞行记录的事件类型
+    enum class FlightEvent : uint8_t {
+        Stripe,         // 激光条纹提取结果：code = 帧号，[r, c, valid]
+        RobotStatus,    // 机器人状态：code = 控制器队列深度，[CartesianPos x6, FLPCartesianPos x6]
+        FilteredPoint,  // 滤波后的焊缝点：code = 帧号，[x, y, z]
+        SentInc,        // 下发的插补增量：code = 报文序列号，[dx, dy, dz, drx, dry, drz]
+        Status,         // 跟踪状态切换：code = TrackStatus
+        Fault,          // 故障：code = FlightFault，触发转储
+        Mark            // 自定义标记
+    };
+
+    /// @brief 触发转储的故障类型
+    enum class FlightFault : int32_t {
+        Request = 0,        // 手动请求
+        RecvCrcError,       // 控制器报文 CRC 错误
+        SendCrcError,       // 控制器报告下发报文 CRC 错误
+        RecvTimeout,        // 等待控制器应答超时
+        SendTimeout         // 发送超时
+    };
+
+    /// @brief 单条记录，定长，写入时整体拷贝
+    struct FlightRecord {
+        static constexpr size_t MaxValues = 12;
+        int64_t timeUs = 0;                 // 相对记录器创建时刻的时间 (us)
+        int32_t code = 0;
+        FlightEvent event = FlightEvent::Mark;
+        uint8_t count = 0;                  // values 中有效的个数
+        double values[MaxValues] = {};
+    };
+
+    /// @brief 内存飞行记录器
+    /// 定容环形缓冲区按全速率记录各线程的条纹结果、机器人状态、滤波点与下发增量，写满后覆盖最旧的记录；
+    /// 写入只有一次位置递增、一次时钟读取与一次定长拷贝，不加锁、不分配内存。
+    /// 每个槽位带序号（seqlock），转储时跳过正在被改写的槽位，记录可与转储同时进行。
+    /// 发生故障时 Trigger 记录故障并唤醒后台线程，把故障前的内容写到转储目录，调用线程不做磁盘 I/O。
+    class FlightRecorder {
+    public:
+        /// @brief 构造函数
+        /// @param capacity 记录条数，向上取 2 的幂
+        /// @param dumpDir 故障转储目录，为空时 Trigger 只记录故障不转储
+        explicit FlightRecorder(size_t capacity = 65536, const std::string& dumpDir = "");
+        ~FlightRecorder();
+
+        // 禁止拷贝和赋值
+        FlightRecorder(const FlightRecorder&) = delete;
+        FlightRecorder& operator=(const FlightRecorder&) = delete;
+
+        /// @brief 追加一条记录（可由多个线程同时调用）
+        /// @param values 数值，超过 FlightRecord::MaxValues 的部分被截断；count 为 0 时可为空指针
+        void Record(FlightEvent event, int32_t code, const double* values, size_t count);
+
+        /// @brief 条纹提取结果
+        void RecordStripe(int32_t frameNo, double r, double c, bool valid);
+
+        /// @brief 滤波后的焊缝点 [x, y, z]
+        void RecordPoint(int32_t frameNo, const double* xyz);
+
+        /// @brief 下发的插补增量，每个增量一条记录
+        void RecordIncs(int32_t serialNumber, const IncPt* incs, size_t incNum);
+
+        /// @brief 跟踪状态切换
+        void RecordStatus(TrackStatus status);
+
+        /// @brief 记录故障并请求转储
+        /// 转储在后台线程进行，转储未完成时的后续触发只记录不重复转储
+        /// @param fault 故障类型
+        /// @param reason 写入转储文件头的说明
+        void Trigger(FlightFault fault, const std::string& reason = "");
+
+        /// @brief 当前内容从旧到新的副本，跳过正在被改写的记录
+        std::vector<FlightRecord> Snapshot() const;
+
+        /// @brief 同步转储到文件
+        /// 每行一条记录：时间 (us)、事件、code、各数值；无法创建文件时抛出 std::runtime_error
+        /// @return 写出的记录数
+        size_t Dump(const std::string& FileName, const std::string& reason = "") const;
+
+        /// @brief 等待后台转储完成
+        /// @return 超时前完成返回 true
+        bool WaitDump(std::chrono::milliseconds timeout) const;
+
+        size_t Capacity() const { return mask_ + 1; }
+
+        /// @brief 累计写入的记录数（含已被覆盖的）
+        uint64_t Recorded() const { return head_.load(std::memory_order_relaxed); }
+
+        /// @brief 已完成的故障转储次数
+        size_t DumpCount() const;
+
+        /// @brief 最近一次故障转储的文件路径
+        std::string LastDumpFile() const;
+
+    private:
+        struct Slot {
+            std::atomic<uint64_t> seq{ 0 };  // 2 * 位置 + 1 表示写入中，2 * 位置 + 2 表示已写完
+            FlightRecord rec;
+        };
+
+        std::unique_ptr<Slot[]> slots_;
+        size_t mask_;
+        alignas(64) std::atomic<uint64_t> head_{ 0 };
+        std::chrono::steady_clock::time_point start_;
+
+        // 后台转储
+        std::string dumpDir_;
+        mutable std::mutex mutex_;
+        mutable std::condition_variable cv_;
+        bool pending_ = false;
+        bool stop_ = false;
+        std::string pendingReason_;
+        FlightFault pendingFault_ = FlightFault::Request;
+        size_t dumpCount_ = 0;
+        std::string lastDumpFile_;
+        std::thread worker_;
+
+        // 占用下一个槽位并写入记录头，调用方写完数值后以 2 * pos + 2 发布
+        Slot& BeginRecord(FlightEvent event, int32_t code, size_t count, uint64_t& pos);
+        // 无数值的记录
+        void RecordEvent(FlightEvent event, int32_t code);
+        void WorkerLoop();
+    };
+
+} // namespace WeldTrackApp
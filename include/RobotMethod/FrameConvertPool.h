@@ -0,0 +1,68 @@
+#pragma once
+
+#include <vector>
+#include <deque>
+#include <memory>
+#include <future>
+#include "WorkStealingPool.h"
+
+namespace WeldTrackApp {
+
+    class LaserCoordToTcp;
+
+    /// @brief 单帧激光条纹数据
+    struct StripeFrame {
+        std::vector<std::vector<double>> pixelPts;  // 条纹像素点 [[r, c], ...]
+        std::vector<double> FLPPoint;               // 采集时法兰盘位姿 [x, y, z, rz, ry, rx]
+    };
+
+    /// @brief 多核并行的帧坐标转换（像素 -> 激光平面 -> 基坐标系）
+    /// 帧间、帧内点块均可分配到不同核，输出严格保持帧序
+    class FrameConvertPool {
+    public:
+        /// @brief 构造函数
+        /// @param threadNum 工作线程数，0 表示取硬件并发数
+        /// @param grain 帧内分块的点数
+        explicit FrameConvertPool(size_t threadNum = 0, size_t grain = 256);
+        ~FrameConvertPool();
+
+        // 禁止拷贝和赋值
+        FrameConvertPool(const FrameConvertPool&) = delete;
+        FrameConvertPool& operator=(const FrameConvertPool&) = delete;
+
+        /// @brief 批量转换多帧（阻塞至全部完成）
+        /// @param frames 输入帧序列
+        /// @return 与输入同序的结果，每帧为基坐标系点集 [[x, y, z], ...]
+        std::vector<std::vector<std::vector<double>>> ConvertFrames(
+            const std::vector<StripeFrame>& frames);
+
+        /// @brief 流水线方式提交一帧（非阻塞）
+        /// @param frame 输入帧
+        void SubmitFrame(StripeFrame frame);
+
+        /// @brief 按提交顺序取出已完成的帧
+        /// @param result [out] 基坐标系点集 [[x, y, z], ...]
+        /// @param wait 队首帧未完成时是否等待
+        /// @return 取出成功返回 true；队列为空或队首未完成（wait = false）返回 false
+        bool PopFrame(std::vector<std::vector<double>>& result, bool wait = false);
+
+        /// @brief 已提交但尚未取出的帧数
+        size_t PendingFrames() const { return pending_frames_.size(); }
+
+        /// @brief 工作线程数
+        size_t ThreadNum() const { return pool_.ThreadNum(); }
+
+    private:
+        // 转换 [begin, end) 范围内的像素点
+        void ConvertRange(const StripeFrame& frame, size_t begin, size_t end,
+            std::vector<std::vector<double>>& out);
+
+        // 每个工作线程（及调用线程）独占一个转换器，避免共享状态
+        std::vector<std::unique_ptr<LaserCoordToTcp>> converters_;
+        size_t grain_;
+        WorkStealingPool pool_;
+
+        std::deque<std::future<std::vector<std::vector<double>>>> pending_frames_;
+    };
+
+} // namespace WeldTrackApp
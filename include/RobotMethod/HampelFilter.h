@@ -0,0 +1,65 @@
+#pragma once
+
+#include <vector>
+#include <array>
+#include <cstddef>
+#include "RobotMethod/SortedWindow.h"
+
+namespace WeldTrackApp {
+
+    /// @brief 流式 Hampel 离群点剔除
+    /// 每个坐标轴维护最近 window 个原始测量值的有序窗口，新测量值与窗口中位数的偏差超过
+    /// nSigma * 1.4826 * MAD 时判为离群（飞溅、弧光反射），以中位数替换后再送入卡尔曼滤波。
+    /// 有序窗口（SortedWindow）在构造时一次分配。
+    class HampelFilter {
+    public:
+        static constexpr size_t DefaultWindow = 15;
+
+        /// @brief 剔除统计
+        struct Stats {
+            size_t samples = 0;                      // 处理的测量点数
+            size_t rejected = 0;                     // 至少一个轴被替换的点数
+            std::array<size_t, 3> axisRejected = {}; // 各轴被替换的次数
+
+            double RejectRate() const { return samples ? static_cast<double>(rejected) / samples : 0.0; }
+        };
+
+        /// @brief 构造函数
+        /// @param window 窗口长度（不小于 3）
+        /// @param nSigma 判定阈值倍数
+        /// @param minSigma 标准差下限 (mm)，避免窗口内数据完全一致时把正常抖动判为离群
+        explicit HampelFilter(size_t window = DefaultWindow, double nSigma = 3.0, double minSigma = 0.02);
+
+        /// @brief 处理一个测量点
+        /// @param pt 测量点 [x, y, z, ...]，3 维以后的分量原样保留
+        /// @return 剔除离群值后的点；窗口未填满一半前原样返回（NaN/Inf 分量除外）
+        /// @note 非有限分量总是判为离群、以窗口中位数替换且不加入窗口；该轴窗口为空时抛出 invalid_argument
+        std::vector<double> Update(const std::vector<double>& pt);
+
+        /// @brief 最近一个点是否被判为离群
+        bool LastRejected() const { return lastRejected_; }
+
+        /// @brief 最近一个点各轴偏差与阈值标准差之比的最大值
+        double LastScore() const { return lastScore_; }
+
+        /// @brief 累计剔除统计
+        const Stats& GetStats() const { return stats_; }
+
+        /// @brief 当前窗口中位数
+        double Median(int axis) const;
+
+        /// @brief 清空窗口与统计
+        void Reset();
+
+    private:
+        size_t window_;
+        double nSigma_;
+        double minSigma_;
+        std::array<SortedWindow<>, 3> axes_;
+
+        bool lastRejected_ = false;
+        double lastScore_ = 0.0;
+        Stats stats_;
+    };
+
+} // namespace WeldTrackApp
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <vector>
+#include <array>
+#include <cstddef>
+#include "RingBuffer.h"
+#include "WTrackDType.h"
+
+namespace WeldTrackApp {
+
+    /// @brief 激光线到焊枪的超前距离队列
+    /// 滤波后的焊缝点按其沿焊缝的累计弧长入队，焊枪实际走过的路程达到"该点弧长 + 超前距离"时出队。
+    /// 与按采样数计的 filterDelay 不同，释放时机只与路程有关，焊接速度变化时仍然正确。
+    /// 入队/出队均为 O(1)，焊枪当前所对应的焊缝位置由相邻焊缝点按弧长插值得到。
+    /// 与上一个焊缝点（焊枪位置）的距离小于 minSpacing 的点不计入：停顿（起弧、机器人暂停）时
+    /// 测量抖动不会累加到弧长和路程中，队列长度由超前距离而不是停顿时长决定。
+    class LeadDistanceQueue {
+    public:
+        using Point3d = std::array<double, 3>;
+        static constexpr size_t Capacity = 2048;            // 最多缓存的焊缝点数
+        static constexpr double DefaultMinSpacing = 0.05;   // 默认最小点距 (mm)
+
+        /// @brief 构造函数
+        /// @param leadDistance 激光线超前焊枪的距离 (mm)
+        /// @param minSpacing 最小点距 (mm)，Capacity * minSpacing 应大于超前距离
+        explicit LeadDistanceQueue(double leadDistance = MacroDefine::LeadDistance,
+            double minSpacing = DefaultMinSpacing);
+
+        /// @brief 清空队列，开始新焊缝
+        void Reset();
+
+        /// @brief 焊缝点入队，距上一个焊缝点不足 minSpacing 的点被忽略
+        /// @param seamPt 滤波后的焊缝点 [x, y, z, ...]
+        /// @return 队列已满时不入队并返回 false
+        bool Push(const std::vector<double>& seamPt);
+
+        /// @brief 以焊枪当前位置更新焊枪已走过的路程
+        /// 距上次计入的位置不足 minSpacing 时不计入，位移累计到 minSpacing 后一并计入
+        /// @param torchPos 焊枪位置 [x, y, z, ...]
+        void UpdateTorch(const std::vector<double>& torchPos);
+
+        /// @brief 直接设置焊枪已走过的路程 (mm)，路程只增不减
+        void SetTorchDistance(double dist);
+
+        /// @brief 弹出焊枪已到达的下一个焊缝点
+        /// @param seamPt [out] 焊缝点 [x, y, z]
+        /// @return 没有已到达的点时返回 false
+        bool PopReached(Point3d& seamPt);
+
+        /// @brief 焊枪当前所对应的焊缝位置（在已释放点与下一个待释放点之间插值）
+        /// @param seamPt [out] 焊缝点 [x, y, z]
+        /// @return 尚无焊缝点时返回 false
+        bool CurrentTarget(Point3d& seamPt) const;
+
+        /// @brief 焊缝上弧长 s 处的位置，在缓存的焊缝点之间插值，超出范围时取端点
+        /// @return 尚无焊缝点时返回 false
+        bool SeamPointAt(double s, Point3d& seamPt) const;
+
+        size_t Size() const { return queue_.Size(); }
+        double LeadDistance() const { return lead_; }
+        double MinSpacing() const { return minSpacing_; }
+        double TorchDistance() const { return torchDist_; }
+        double SeamLength() const { return seamLen_; }
+
+    private:
+        struct Entry {
+            Point3d pt = {};
+            double s = 0.0;  // 沿焊缝的累计弧长
+        };
+
+        double lead_;
+        double minSpacing_;
+        RingBuffer<Entry, Capacity> queue_;
+
+        Entry lastReleased_;
+        bool hasReleased_ = false;
+
+        Point3d lastSeamPt_ = {};
+        double seamLen_ = 0.0;
+        bool hasSeamPt_ = false;
+
+        Point3d lastTorchPos_ = {};
+        double torchDist_ = 0.0;
+        bool hasTorchPos_ = false;
+    };
+
+} // namespace WeldTrackApp
@@ -8,12 +8,37 @@
 #include <random>
 #include <cstring>
 #include <stdexcept>
+#include <algorithm>
+#include <deque>
+#include <chrono>
+#include "WTrackDType.h"
+#include "RobotMethod/FlightRecorder.h"
+
+#ifdef _WIN32
 #include <winsock2.h>
 #include <ws2tcpip.h>
 
 #pragma comment(lib, "ws2_32.lib")
-
-// ͨؽṹ嶨
+#else
+#include <sys/socket.h>
+#include <sys/epoll.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+#endif
+
+// 机器人控制器地址，可在包含本头文件前定义以覆盖
+#ifndef MOTOMAN_ROBOT_IP
+#define MOTOMAN_ROBOT_IP "192.168.255.101"
+#endif
+#ifndef MOTOMAN_ROBOT_PORT
+#define MOTOMAN_ROBOT_PORT 50240
+#endif
+
+// 机器人通信相关结构体定义
 struct RobotSendMsg {
     int count = 0;
     int serialNumber = 0;
@@ -23,7 +48,7 @@ struct RobotSendMsg {
     int ifStopTcp = 0;
     int CRCData = 0;
 
-    // ˶
+    // 运动数据
     struct IncDataType {
         int incData[6] = { 0 };
         int incDataType = 0;
@@ -51,7 +76,7 @@ struct RobotStatus {
     int CurQueueCount = 0;
 };
 
-// ͨ״̬ö
+// 通信状态枚举
 enum class Tcp_Comm_Status {
     tcpClient_null,
     tcpClient_no_connect,
@@ -69,17 +94,17 @@ enum class Tcp_Data_Status {
 
 class MotoManTCP {
 public:
-    // 
+    // 单例访问
     static MotoManTCP& GetInstance() {
         static MotoManTCP instance;
         return instance;
     }
 
-    // ֹ͸ֵ
+    // 禁止拷贝和赋值
     MotoManTCP(const MotoManTCP&) = delete;
     MotoManTCP& operator=(const MotoManTCP&) = delete;
 
-    // Ϣ
+    // 生成数字量输出消息
     void Gen_SendMsgToOut(int port, int value) {
         std::lock_guard<std::mutex> lock(queue_mutex_);
 
@@ -96,7 +121,7 @@ public:
         all_robot_send_msgs_.push_back(msg);
     }
 
-    // ˶Ϣ
+    // 生成运动数据消息
     void Gen_SendMsgToQueue(const std::vector<std::vector<int>>& incDatas) {
         std::lock_guard<std::mutex> lock(queue_mutex_);
 
@@ -111,7 +136,7 @@ public:
             int count = 0;
 
             for (int j = 0; j < incDataPerMsg; j++) {
-                int idx = startIdx + j;
+                size_t idx = static_cast<size_t>(startIdx + j);
                 if (idx >= incDatas.size()) break;
 
                 const auto& data = incDatas[idx];
@@ -119,7 +144,7 @@ public:
 
                 std::memcpy(msg.datalist[j].incData, data.data(), 6 * sizeof(int));
                 msg.datalist[j].incDataType = 0x90;
-                msg.datalist[j].toolNo = tool_no_; // ʹԱ
+                msg.datalist[j].toolNo = tool_no_; // 使用类成员变量
                 count++;
             }
 
@@ -129,23 +154,58 @@ public:
         }
     }
 
-    // ȡ״̬
+    // 生成运动数据消息（连续增量缓冲区，每个增量整体拷贝一次）
+    void Gen_SendMsgToQueue(const WeldTrackApp::IncPt* incPts, size_t incNum) {
+        static_assert(sizeof(WeldTrackApp::IncPt) == sizeof(RobotSendMsg::IncDataType::incData),
+            "IncPt layout must match IncDataType::incData");
+
+        std::lock_guard<std::mutex> lock(queue_mutex_);
+
+        const size_t incDataPerMsg = RobotSendMsg::IncData_Count;
+
+        for (size_t startIdx = 0; startIdx < incNum; startIdx += incDataPerMsg) {
+            RobotSendMsg msg;
+            Init_RobotSendMsg(msg);
+
+            const size_t count = std::min(incDataPerMsg, incNum - startIdx);
+            for (size_t j = 0; j < count; j++) {
+                std::memcpy(msg.datalist[j].incData, incPts[startIdx + j].d, sizeof(WeldTrackApp::IncPt));
+                msg.datalist[j].incDataType = 0x90;
+                msg.datalist[j].toolNo = tool_no_;
+            }
+
+            msg.count = static_cast<int>(count);
+            Cal_SendMsgCRC(msg);
+            all_robot_send_msgs_.push_back(msg);
+        }
+    }
+
+    void Gen_SendMsgToQueue(const std::vector<WeldTrackApp::IncPt>& incPts) {
+        Gen_SendMsgToQueue(incPts.data(), incPts.size());
+    }
+
+    // 获取机器人状态
     RobotStatus GetRobotStatus() const {
         std::lock_guard<std::mutex> lock(status_mutex_);
         return robot_status_;
     }
 
-    // ȡͨ״̬
+    // 设置飞行记录器：记录收发报文，通讯故障时触发转储（nullptr 表示不记录）
+    void SetFlightRecorder(WeldTrackApp::FlightRecorder* recorder) {
+        recorder_ = recorder;
+    }
+
+    // 获取通信状态
     Tcp_Comm_Status GetCommStatus() const {
         return comm_status_.load();
     }
 
-    // ȡ״̬
+    // 获取数据状态
     Tcp_Data_Status GetDataStatus() const {
         return data_status_.load();
     }
 
-    // ֹͣͨ
+    // 停止通信
     void Stop() {
         running_ = false;
 
@@ -154,58 +214,89 @@ public:
         }
 
         CloseConnection();
+#ifdef _WIN32
         WSACleanup();
+#endif
     }
 
 private:
-    // 
-    static constexpr int tool_no_ = 1; // ߺ
-    static constexpr int queue_max_count_ = 50; // 
-    static constexpr int crc_array_size_ = 128; // CRCС
-
-    // ˽й캯ģʽ
+    // 常量定义
+    static constexpr int tool_no_ = 1; // 工具号
+    static constexpr int queue_max_count_ = 50; // 最大队列数
+    static constexpr int crc_array_size_ = 128; // CRC计算数组大小
+    static constexpr int connect_timeout_ms_ = 1000; // 连接超时
+    static constexpr int send_timeout_ms_ = 100; // 发送超时
+    static constexpr int recv_wait_ms_ = 10; // 单次等待接收的时间
+    static constexpr int reconnect_min_ms_ = 100; // 重连间隔初值，失败后加倍
+    static constexpr int reconnect_max_ms_ = 2000; // 重连间隔上限
+
+#ifdef _WIN32
+    using SocketHandle = SOCKET;
+    static constexpr SocketHandle invalid_socket_ = INVALID_SOCKET;
+#else
+    using SocketHandle = int;
+    static constexpr SocketHandle invalid_socket_ = -1;
+#endif
+
+    // 私有构造函数（单例模式）
     MotoManTCP()
-        : running_(true),
-        comm_status_(Tcp_Comm_Status::tcpClient_no_connect),
-        data_status_(Tcp_Data_Status::tcpData_null) {
+        : comm_status_(Tcp_Comm_Status::tcpClient_no_connect),
+        data_status_(Tcp_Data_Status::tcpData_null),
+        running_(true) {
 
-        // ʼWinsock
+#ifdef _WIN32
+        // 初始化Winsock
         WSADATA wsaData;
         if (WSAStartup(MAKEWORD(2, 2), &wsaData) != 0) {
             throw std::runtime_error("WSAStartup failed");
         }
+#endif
 
-        // TCP
-        if (TCP_Connect()) {
-            tcp_thread_ = std::thread(&MotoManTCP::Do_TcpProcess, this);
-        }
+        // 连接TCP，未连接时由通信线程重连
+        TCP_Connect();
+        tcp_thread_ = std::thread(&MotoManTCP::Do_TcpProcess, this);
     }
 
-    // ʼϢ
+    // 初始化发送消息
     void Init_RobotSendMsg(RobotSendMsg& msg) {
-        msg = RobotSendMsg(); // ΪĬֵ
+        msg = RobotSendMsg(); // 重置为默认值
         msg.serialNumber = dist_(rng_);
         msg.ifRequestData = 1;
     }
 
-    // 㷢ϢCRC
+    // 计算发送消息的CRC
     void Cal_SendMsgCRC(RobotSendMsg& msg) {
-        // ṹתΪֽCRC
+        // 将结构体转换为字节数组进行CRC计算
         char buffer[sizeof(RobotSendMsg)];
         std::memcpy(buffer, &msg, sizeof(RobotSendMsg));
 
-        // CRCʵ֣
+        // 计算CRC（简化实现）
         msg.CRCData = cal_crc(reinterpret_cast<int*>(buffer), sizeof(RobotSendMsg) / sizeof(int));
     }
 
-    // TCPͨ߳
+    // TCP通信线程
     void Do_TcpProcess() {
         RobotSendMsg current_send;
         RobotRecvMsg current_recv;
-        char recv_buffer[sizeof(RobotRecvMsg)];
+        int reconnect_ms = reconnect_min_ms_;
 
         while (running_) {
-            // ׼Ϣ
+            // 连接断开时按退避间隔重连
+            if (socket_ == invalid_socket_) {
+                for (int waited = 0; running_ && waited < reconnect_ms; waited += recv_wait_ms_) {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(recv_wait_ms_));
+                }
+                if (!running_) {
+                    break;
+                }
+                if (!TCP_Connect()) {
+                    reconnect_ms = std::min(reconnect_ms * 2, reconnect_max_ms_);
+                    continue;
+                }
+                reconnect_ms = reconnect_min_ms_;
+            }
+
+            // 准备发送消息
             {
                 std::lock_guard<std::mutex> lock(queue_mutex_);
 
@@ -221,60 +312,60 @@ private:
                 }
             }
 
-            // 
-            SendData(current_send);
+            // 发送数据，未发出的运动数据放回队首，下次重发
+            if (!SendData(current_send)) {
+                if (current_send.count > 0) {
+                    std::lock_guard<std::mutex> lock(queue_mutex_);
+                    all_robot_send_msgs_.push_front(current_send);
+                }
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                continue;
+            }
+            Record_SendMsg(current_send);
 
-            // 
+            // 接收数据
             int wait_count = 0;
             bool received = false;
 
-            while (running_ && !received) {
-                fd_set read_set;
-                FD_ZERO(&read_set);
-                FD_SET(socket_, &read_set);
-
-                timeval timeout = { 0, 10000 }; // 10ms
-
-                // Ƿݿɶ
-                int ready = select(0, &read_set, nullptr, nullptr, &timeout);
-                if (ready > 0 && FD_ISSET(socket_, &read_set)) {
-                    int bytes_received = recv(socket_, recv_buffer, sizeof(recv_buffer), 0);
-                    if (bytes_received == sizeof(RobotRecvMsg)) {
-                        std::memcpy(&current_recv, recv_buffer, sizeof(RobotRecvMsg));
-                        received = true;
-                    }
+            while (running_ && !received && socket_ != invalid_socket_) {
+                // 检查是否有数据可读（10ms）
+                if (WaitSocket(false, recv_wait_ms_)) {
+                    received = RecvData(current_recv);
                 }
 
-                // ÿ10طһΣԷϢ
+                // 每10次重发一次（仅对非数据消息）
                 if (++wait_count % 10 == 0 && current_send.count == 0) {
                     SendData(current_send);
                 }
 
-                // ʱ
+                // 超时处理
                 if (wait_count > 100) {
-                    data_status_ = Tcp_Data_Status::tcpData_null;
+                    Set_DataFault(Tcp_Data_Status::tcpData_null,
+                        WeldTrackApp::FlightFault::RecvTimeout, "robot response timeout");
                     break;
                 }
             }
 
-            // յ
+            // 处理接收到的数据
             if (received) {
-                // ֤CRC
+                // 验证CRC
                 char recv_crc_buffer[sizeof(RobotRecvMsg)];
                 std::memcpy(recv_crc_buffer, &current_recv, sizeof(RobotRecvMsg));
                 int calculated_crc = cal_crc(reinterpret_cast<int*>(recv_crc_buffer),
                     sizeof(RobotRecvMsg) / sizeof(int));
 
                 if (calculated_crc != current_recv.CRCData) {
-                    data_status_ = Tcp_Data_Status::tcpData_Recv_CRC_Error;
+                    Set_DataFault(Tcp_Data_Status::tcpData_Recv_CRC_Error,
+                        WeldTrackApp::FlightFault::RecvCrcError, "receive CRC error");
                 }
                 else if (current_recv.is_CRCOk == 0) {
-                    data_status_ = Tcp_Data_Status::tcpData_Send_CRC_Error;
+                    Set_DataFault(Tcp_Data_Status::tcpData_Send_CRC_Error,
+                        WeldTrackApp::FlightFault::SendCrcError, "send CRC error reported by robot");
                 }
                 else {
                     data_status_ = Tcp_Data_Status::tcpData_ok;
 
-                    // »״̬
+                    // 更新机器人状态
                     std::lock_guard<std::mutex> lock(status_mutex_);
                     for (int i = 0; i < 6; i++) {
                         robot_status_.CartesianPos[i] = current_recv.CartesianPos[i] / 1000.0;
@@ -286,6 +377,7 @@ private:
                     }
 
                     robot_status_.CurQueueCount = current_recv.CurQueueCount;
+                    Record_RobotStatus(robot_status_);
                 }
             }
 
@@ -293,28 +385,53 @@ private:
         }
     }
 
-    // ӵ˿
+    // 连接到机器人控制器
     bool TCP_Connect() {
-        SOCKADDR_IN server_addr;
+        sockaddr_in server_addr = {};
         server_addr.sin_family = AF_INET;
-        server_addr.sin_port = htons(50240);
-        inet_pton(AF_INET, "192.168.255.101", &server_addr.sin_addr);
+        server_addr.sin_port = htons(MOTOMAN_ROBOT_PORT);
+        inet_pton(AF_INET, MOTOMAN_ROBOT_IP, &server_addr.sin_addr);
 
         socket_ = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
-        if (socket_ == INVALID_SOCKET) {
+        if (socket_ == invalid_socket_) {
             comm_status_ = Tcp_Comm_Status::tcpClient_null;
             return false;
         }
 
-        // ÷ͳʱ
-        DWORD timeout = 100; // 100ms
+        // 关闭 Nagle 算法，报文立即发出
+        int nodelay = 1;
+        setsockopt(socket_, IPPROTO_TCP, TCP_NODELAY,
+            reinterpret_cast<const char*>(&nodelay), sizeof(nodelay));
+
+#ifdef _WIN32
+        // 设置发送超时
+        DWORD timeout = send_timeout_ms_;
         setsockopt(socket_, SOL_SOCKET, SO_SNDTIMEO,
             reinterpret_cast<const char*>(&timeout), sizeof(timeout));
 
-        // ӷ
-        if (connect(socket_, reinterpret_cast<SOCKADDR*>(&server_addr), sizeof(server_addr)) == SOCKET_ERROR) {
-            closesocket(socket_);
-            socket_ = INVALID_SOCKET;
+        // 连接服务器
+        bool connected = connect(socket_, reinterpret_cast<sockaddr*>(&server_addr), sizeof(server_addr)) != SOCKET_ERROR;
+#else
+        // 非阻塞套接字，收发等待由 epoll 完成
+        epoll_fd_ = epoll_create1(EPOLL_CLOEXEC);
+        epoll_event ev = {};
+        ev.events = EPOLLOUT;
+        ev.data.fd = socket_;
+        epoll_write_ = true;
+        bool connected = epoll_fd_ >= 0
+            && fcntl(socket_, F_SETFL, fcntl(socket_, F_GETFL, 0) | O_NONBLOCK) == 0
+            && epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, socket_, &ev) == 0;
+
+        // 连接服务器，等待连接完成后检查结果
+        if (connected && connect(socket_, reinterpret_cast<sockaddr*>(&server_addr), sizeof(server_addr)) != 0) {
+            int error = 0;
+            socklen_t len = sizeof(error);
+            connected = errno == EINPROGRESS && WaitSocket(true, connect_timeout_ms_)
+                && getsockopt(socket_, SOL_SOCKET, SO_ERROR, &error, &len) == 0 && error == 0;
+        }
+#endif
+        if (!connected) {
+            CloseSocket();
             comm_status_ = Tcp_Comm_Status::tcpClient_no_connect;
             return false;
         }
@@ -323,10 +440,10 @@ private:
         return true;
     }
 
-    // ر
+    // 关闭连接
     void CloseConnection() {
-        if (socket_ != INVALID_SOCKET) {
-            // ֹͣ
+        if (socket_ != invalid_socket_) {
+            // 发送停止命令
             RobotSendMsg stop_msg;
             Init_RobotSendMsg(stop_msg);
             stop_msg.ifStopTcp = 1;
@@ -338,31 +455,201 @@ private:
             SendData(stop_msg);
             std::this_thread::sleep_for(std::chrono::milliseconds(100));
 
-            // ر׽
+            // 关闭套接字
+            CloseSocket();
+        }
+    }
+
+    // 关闭套接字
+    void CloseSocket() {
+        if (socket_ != invalid_socket_) {
+#ifdef _WIN32
             closesocket(socket_);
-            socket_ = INVALID_SOCKET;
+#else
+            ::close(socket_);
+#endif
+            socket_ = invalid_socket_;
         }
+#ifndef _WIN32
+        if (epoll_fd_ >= 0) {
+            ::close(epoll_fd_);
+            epoll_fd_ = -1;
+        }
+#endif
+        recv_fill_ = 0;
     }
 
-    // 
-    void SendData(const RobotSendMsg& msg) {
-        if (socket_ == INVALID_SOCKET) {
-            comm_status_ = Tcp_Comm_Status::tcpClient_null;
-            return;
+    // 等待套接字可读（write = false）或可写（write = true），超时返回 false
+    bool WaitSocket(bool write, int timeout_ms) {
+        if (socket_ == invalid_socket_) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(timeout_ms));
+            return false;
+        }
+#ifdef _WIN32
+        fd_set socket_set;
+        FD_ZERO(&socket_set);
+        FD_SET(socket_, &socket_set);
+
+        timeval timeout = { timeout_ms / 1000, (timeout_ms % 1000) * 1000 };
+        int ready = write ? select(0, nullptr, &socket_set, nullptr, &timeout)
+            : select(0, &socket_set, nullptr, nullptr, &timeout);
+        return ready > 0;
+#else
+        // 平时只关注可读，发送缓冲区满时临时切换为可写
+        if (write != epoll_write_) {
+            epoll_event ev = {};
+            ev.events = write ? EPOLLOUT : EPOLLIN;
+            ev.data.fd = socket_;
+            epoll_ctl(epoll_fd_, EPOLL_CTL_MOD, socket_, &ev);
+            epoll_write_ = write;
+        }
+
+        epoll_event ready_event;
+        int ready;
+        do {
+            ready = epoll_wait(epoll_fd_, &ready_event, 1, timeout_ms);
+        } while (ready < 0 && errno == EINTR);
+        return ready > 0;
+#endif
+    }
+
+    // 接收数据：报文可能分多次到达，凑满一帧后返回 true
+    bool RecvData(RobotRecvMsg& msg) {
+        const size_t want = sizeof(RobotRecvMsg) - recv_fill_;
+#ifdef _WIN32
+        int bytes_received = recv(socket_, recv_buffer_ + recv_fill_, static_cast<int>(want), 0);
+        bool would_block = false;
+#else
+        ssize_t bytes_received;
+        do {
+            bytes_received = ::recv(socket_, recv_buffer_ + recv_fill_, want, 0);
+        } while (bytes_received < 0 && errno == EINTR);
+        bool would_block = bytes_received < 0 && (errno == EAGAIN || errno == EWOULDBLOCK);
+#endif
+        if (bytes_received <= 0) {
+            // 对端关闭或连接出错
+            if (!would_block) {
+                CloseSocket();
+                comm_status_ = Tcp_Comm_Status::tcpClient_no_connect;
+            }
+            return false;
+        }
+
+        recv_fill_ += static_cast<size_t>(bytes_received);
+        if (recv_fill_ < sizeof(RobotRecvMsg)) {
+            return false;
+        }
+        std::memcpy(&msg, recv_buffer_, sizeof(RobotRecvMsg));
+        recv_fill_ = 0;
+        return true;
+    }
+
+    // 发送数据，报文完整发出返回 true
+    // 未连接时不改变通信状态（保持 tcpClient_no_connect / tcpClient_null）
+    bool SendData(const RobotSendMsg& msg) {
+        if (socket_ == invalid_socket_) {
+            return false;
         }
 
         char send_buffer[sizeof(RobotSendMsg)];
         std::memcpy(send_buffer, &msg, sizeof(RobotSendMsg));
 
-        if (send(socket_, send_buffer, sizeof(send_buffer), 0) == SOCKET_ERROR) {
-            comm_status_ = Tcp_Comm_Status::tcpClient_sendTimeOut;
-        }
-        else {
+        bool stream_broken = false;
+        if (SendAll(send_buffer, sizeof(send_buffer), stream_broken)) {
             comm_status_ = Tcp_Comm_Status::tcpClient_ok;
+            return true;
+        }
+
+        // 只在进入发送超时状态时触发转储
+        if (comm_status_.exchange(Tcp_Comm_Status::tcpClient_sendTimeOut) != Tcp_Comm_Status::tcpClient_sendTimeOut) {
+            Trigger_Fault(WeldTrackApp::FlightFault::SendTimeout, "send timeout");
+        }
+
+        // 报文只发出一部分时字节流已错位，后续报文都会被控制器错误分帧，必须断开重连
+        if (stream_broken) {
+            CloseSocket();
+            comm_status_ = Tcp_Comm_Status::tcpClient_no_connect;
+        }
+        return false;
+    }
+
+    // 发送完整报文，超过发送超时返回 false
+    // stream_broken：已发出部分字节或连接出错，套接字不可继续使用
+    bool SendAll(const char* data, size_t size, bool& stream_broken) {
+#ifdef _WIN32
+        // Winsock 发送超时后套接字状态不确定，不可继续使用
+        stream_broken = send(socket_, data, static_cast<int>(size), 0) == SOCKET_ERROR;
+        return !stream_broken;
+#else
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(send_timeout_ms_);
+        size_t sent = 0;
+        while (sent < size) {
+            ssize_t n = ::send(socket_, data + sent, size - sent, MSG_NOSIGNAL);
+            if (n > 0) {
+                sent += static_cast<size_t>(n);
+                continue;
+            }
+            if (n < 0 && errno == EINTR) {
+                continue;
+            }
+            if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+                // 发送缓冲区已满，等待可写直到超时
+                auto left = std::chrono::duration_cast<std::chrono::milliseconds>(
+                    deadline - std::chrono::steady_clock::now()).count();
+                if (left > 0 && WaitSocket(true, static_cast<int>(left))) {
+                    continue;
+                }
+                stream_broken = sent > 0;
+                return false;
+            }
+            stream_broken = true;  // 连接出错
+            return false;
+        }
+        return true;
+#endif
+    }
+
+    // 记录下发的插补增量
+    void Record_SendMsg(const RobotSendMsg& msg) {
+        WeldTrackApp::FlightRecorder* recorder = recorder_.load();
+        if (recorder == nullptr) return;
+
+        for (int i = 0; i < msg.count; i++) {
+            double values[6];
+            for (int j = 0; j < 6; j++) {
+                values[j] = msg.datalist[i].incData[j];
+            }
+            recorder->Record(WeldTrackApp::FlightEvent::SentInc, msg.serialNumber, values, 6);
         }
     }
 
-    // CRCУ
+    // 记录机器人状态（位置单位 mm）
+    void Record_RobotStatus(const RobotStatus& status) {
+        WeldTrackApp::FlightRecorder* recorder = recorder_.load();
+        if (recorder == nullptr) return;
+
+        double values[12];
+        std::memcpy(values, status.CartesianPos, sizeof(status.CartesianPos));
+        std::memcpy(values + 6, status.FLPCartesianPos, sizeof(status.FLPCartesianPos));
+        recorder->Record(WeldTrackApp::FlightEvent::RobotStatus, status.CurQueueCount, values, 12);
+    }
+
+    // 设置数据故障状态，只在状态改变时触发转储，持续的同一故障不重复转储
+    void Set_DataFault(Tcp_Data_Status status, WeldTrackApp::FlightFault fault, const char* reason) {
+        if (data_status_.exchange(status) != status) {
+            Trigger_Fault(fault, reason);
+        }
+    }
+
+    // 记录通讯故障并触发转储
+    void Trigger_Fault(WeldTrackApp::FlightFault fault, const char* reason) {
+        WeldTrackApp::FlightRecorder* recorder = recorder_.load();
+        if (recorder != nullptr) {
+            recorder->Trigger(fault, reason);
+        }
+    }
+
+    // 计算CRC校验码
     int cal_crc(int* data, int length) {
         int crc = 0xffff;
 
@@ -383,26 +670,35 @@ private:
     }
 
 private:
-    // 
-    SOCKET socket_ = INVALID_SOCKET;
-
-    // ݶ
+    // 网络相关
+    SocketHandle socket_ = invalid_socket_;
+#ifndef _WIN32
+    int epoll_fd_ = -1;
+    bool epoll_write_ = false; // epoll 当前关注可写还是可读
+#endif
+    char recv_buffer_[sizeof(RobotRecvMsg)];
+    size_t recv_fill_ = 0; // 接收缓冲区中已有的字节数
+
+    // 数据队列
     std::deque<RobotSendMsg> all_robot_send_msgs_;
     std::mutex queue_mutex_;
 
-    // ״̬
+    // 机器人状态
     RobotStatus robot_status_;
-    std::mutex status_mutex_;
+    mutable std::mutex status_mutex_;
 
-    // ͨ״̬
+    // 通信状态
     std::atomic<Tcp_Comm_Status> comm_status_;
     std::atomic<Tcp_Data_Status> data_status_;
 
-    // ߳̿
+    // 飞行记录器
+    std::atomic<WeldTrackApp::FlightRecorder*> recorder_{ nullptr };
+
+    // 线程控制
     std::thread tcp_thread_;
     std::atomic<bool> running_;
 
-    // 
+    // 随机数生成
     std::mt19937 rng_{std::random_device{}()};
     std::uniform_int_distribution<int> dist_{0, 10000};
 };
\ No newline at end of file
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <vector>
+#include <cstddef>
+#include "WorkStealingPool.h"
+
+namespace WeldTrackApp {
+
+    /// @brief 按列存储（SoA）的轨迹点集
+    /// 各坐标分量连续存放，长度计算内核可被编译器向量化。
+    struct TrackPathSoA {
+        std::vector<double> x, y, z;
+        std::vector<double> rx, ry, rz;  // 姿态，可为空
+
+        size_t Size() const { return x.size(); }
+
+        /// @brief 由按行存储的轨迹数据转换
+        /// @param rows 轨迹数据，每行位置位于 [posOffset, posOffset + 2]，姿态紧随其后
+        /// @param posOffset 位置起始下标（示教轨迹为 0，trackDatas_Save 为 5）
+        /// @param withAtt 是否同时提取姿态
+        /// @param pool 线程池，为空时在调用线程中转换
+        static TrackPathSoA FromRows(const std::vector<std::vector<double>>& rows,
+            size_t posOffset = 0, bool withAtt = true, WorkStealingPool* pool = nullptr);
+    };
+
+    /// @brief 轨迹统计结果
+    struct PathStats {
+        double totalLen = 0.0;            // 总长度 (mm)
+        std::vector<double> segLen;       // 相邻两点间长度，共 n - 1 个
+        std::vector<double> cumLen;       // 各点处的累计长度，共 n 个，cumLen[0] = 0
+        std::vector<double> incAtt;       // 首末点姿态增量 [Δrx, Δry, Δrz] (度)，无姿态时为 0
+    };
+
+    /// @brief 大规模轨迹的并行统计
+    /// 一次遍历同时得到总长度、分段长度、累计长度与姿态增量，结果与 Cal_WeldPara / Cal_totalLength 一致
+    /// （求和顺序不同，仅有舍入误差）。点集按块划分：各块并行计算分段长度与块内前缀和，
+    /// 再串行累加块偏移并并行修正，线程池为空时全部在调用线程中完成。
+    class PathStatistics {
+    public:
+        static constexpr size_t DefaultGrain = 16384;  // 每个任务块的点数
+
+        /// @param pool 线程池，为空时串行计算
+        /// @param grain 每个任务块的点数
+        explicit PathStatistics(WorkStealingPool* pool = nullptr, size_t grain = DefaultGrain);
+
+        /// @brief 计算轨迹统计
+        /// @param path 轨迹点集
+        /// @param stats [out] 统计结果
+        /// @return 点数不足 2 时返回 false
+        bool Calculate(const TrackPathSoA& path, PathStats& stats) const;
+
+    private:
+        WorkStealingPool* pool_;
+        size_t grain_;
+
+        template <typename F>
+        void ForEachChunk(size_t n, F&& func) const;
+    };
+
+} // namespace WeldTrackApp
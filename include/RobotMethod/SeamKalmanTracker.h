@@ -0,0 +1,124 @@
+#pragma once
+
+#include <vector>
+#include <array>
+#include <cstddef>
+#include "WTrackDType.h"
+
+namespace WeldTrackApp {
+
+    /// @brief 单轴运动模型卡尔曼滤波（SeamKalmanTracker 的每个坐标轴，FilterPolicy::Kalman<CV> 的实现）
+    /// Order = 2 为匀速模型，状态 [p, v]；Order = 3 为匀加速模型，状态 [p, v, a]。只观测位置。
+    template <int Order = 2>
+    class SeamAxisKalman {
+        static_assert(Order == 2 || Order == 3, "SeamAxisKalman supports CV (2) or CA (3) model");
+
+    public:
+        using State = std::array<double, Order>;
+        using Cov = std::array<std::array<double, Order>, Order>;
+
+        /// @brief 构造函数
+        /// @param dt 测量周期 (s)
+        /// @param PNoiseCov 过程噪声谱密度（CV 为加速度噪声，CA 为加加速度噪声）
+        /// @param MNoiseCov 测量噪声协方差 (mm^2)
+        SeamAxisKalman(double dt, double PNoiseCov, double MNoiseCov);
+
+        /// @brief 输入一个测量值并返回位置估计，首个测量值直接作为初始状态
+        double Update(double z);
+
+        /// @brief 当前状态 [p, v, (a)]
+        const State& GetState() const { return x_; }
+
+        /// @brief 按当前状态外推位置（不改变滤波状态）
+        /// @param horizon 前视时间 (s)
+        double Extrapolate(double horizon) const;
+
+        /// @brief 清空滤波状态（模型参数不变）
+        void Reset();
+
+    private:
+        // 状态转移矩阵与过程噪声矩阵（由 dt 预计算）
+        Cov F_ = {};
+        Cov Q_ = {};
+        double r_;
+
+        State x_ = {};
+        Cov P_ = {};
+        bool init_ = false;
+
+        void Init(double z);
+        void Predict();
+        void Correct(double z);
+    };
+
+    /// @brief 焊缝点三维运动模型卡尔曼跟踪器
+    /// Order = 2 为匀速模型 (CV)，状态 [p, v]；Order = 3 为匀加速模型 (CA)，状态 [p, v, a]。
+    /// x / y / z 三轴独立滤波（SeamAxisKalman），协方差矩阵为定长数组（栈上分配），每次更新 O(1)。
+    /// 相比 Cal_KalmanFilter 的随机游走模型，稳定弯曲的焊缝不再产生滞后，
+    /// 并可按前视距离外推焊缝位置。
+    template <int Order = 2>
+    class SeamKalmanTracker {
+        static_assert(Order == 2 || Order == 3, "SeamKalmanTracker supports CV (2) or CA (3) model");
+
+    public:
+        using Point3d = std::array<double, 3>;
+
+        /// @brief 构造函数（三轴参数相同）
+        /// @param dt 测量周期 (s)
+        /// @param PNoiseCov 过程噪声谱密度（CV 为加速度噪声，CA 为加加速度噪声）
+        /// @param MNoiseCov 测量噪声协方差 (mm^2)
+        SeamKalmanTracker(double dt, double PNoiseCov, double MNoiseCov);
+
+        /// @brief 构造函数（三轴参数分别设置）
+        SeamKalmanTracker(double dt, const Point3d& PNoiseCov, const Point3d& MNoiseCov);
+
+        /// @brief 输入一个新的测量点并返回滤波结果
+        /// @param meaPt 测量点 [x, y, z, ...]，不足3维的点被忽略
+        /// @return 滤波后的点 [x, y, z]
+        std::vector<double> Update(const std::vector<double>& meaPt);
+
+        /// @brief 以测量历史为输入的增量接口（参照 TrackAlgMethod::mea_Pos_Filter 的数据形式，
+        /// 但噪声参数在构造时给定，不是其直接替代）
+        /// 输入可为不断增长的历史，也可为定长滑动窗口。新点数按窗口长度的增量计算；
+        /// 窗口长度不变（滑动窗口已满）时视为至少推进了一个点，仅当窗口内容与上次完全相同时不处理。
+        /// 新点数均与上次处理过的最后 TailMatch 个点按内容校验，无法对齐时视为新焊缝并重新开始。
+        /// 停顿中的重复测量点因此仍逐点预测/更新，速度估计随之衰减
+        /// @param trackDatas_Save 原始跟踪数据集合 [x, y, z, ...]
+        /// @return 滤波后的点 [x, y, z]，尚无测量点时返回 [0, 0, 0]
+        std::vector<double> mea_Pos_Filter(const std::vector<std::vector<double>>& trackDatas_Save);
+
+        /// @brief 当前滤波结果
+        /// @return 滤波后的点 [x, y, z]，尚无测量点时返回 [0, 0, 0]
+        std::vector<double> GetFilterPt() const;
+
+        /// @brief 当前速度估计 [vx, vy, vz] (mm/s)
+        std::vector<double> GetVelocity() const;
+
+        /// @brief 按当前状态外推焊缝位置（不改变滤波状态）
+        /// @param horizon 前视时间 (s)
+        /// @return 外推点 [x, y, z]
+        std::vector<double> Predict(double horizon) const;
+
+        /// @brief 已输入的有效测量点数
+        size_t Count() const { return count_; }
+
+        /// @brief 清空滤波状态（模型参数不变）
+        void Reset();
+
+    private:
+        static constexpr size_t TailMatch = 8;
+
+        std::array<SeamAxisKalman<Order>, 3> axes_;
+        size_t count_ = 0;
+        std::vector<Point3d> tail_;                  // mea_Pos_Filter 最近处理的点，用于对齐窗口
+        size_t lastRows_ = 0;                        // mea_Pos_Filter 上次输入的有效行数
+        std::vector<const std::vector<double>*> rows_;  // mea_Pos_Filter 的有效行（复用）
+    };
+
+    using SeamCVTracker = SeamKalmanTracker<2>;
+    using SeamCATracker = SeamKalmanTracker<3>;
+
+} // namespace WeldTrackApp
+
+// 实现模板类必须在头文件中
+#include "SeamKalmanTracker.inl"
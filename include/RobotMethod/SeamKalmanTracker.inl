@@ -0,0 +1,277 @@
+#include <stdexcept>
+#include <algorithm>
+
+namespace WeldTrackApp {
+
+    // 构造函数：预计算状态转移矩阵与离散化过程噪声
+    template <int Order>
+    SeamAxisKalman<Order>::SeamAxisKalman(double dt, double PNoiseCov, double MNoiseCov)
+        : r_(MNoiseCov)
+    {
+        if (dt <= 0.0) {
+            throw std::invalid_argument("dt must be bigger than 0");
+        }
+        if (PNoiseCov < 0.0 || MNoiseCov <= 0.0) {
+            throw std::invalid_argument("noise covariance must be positive");
+        }
+
+        const double dt2 = dt * dt;
+        const double dt3 = dt2 * dt;
+
+        for (int i = 0; i < Order; ++i) {
+            F_[i][i] = 1.0;
+        }
+        F_[0][1] = dt;
+        if constexpr (Order == 3) {
+            F_[0][2] = 0.5 * dt2;
+            F_[1][2] = dt;
+        }
+
+        const double q = PNoiseCov;
+        if constexpr (Order == 2) {
+            // 连续白噪声加速度模型
+            Q_[0][0] = q * dt3 / 3.0;
+            Q_[0][1] = q * dt2 / 2.0;
+            Q_[1][0] = Q_[0][1];
+            Q_[1][1] = q * dt;
+        }
+        else {
+            // 连续白噪声加加速度模型
+            const double dt4 = dt3 * dt;
+            const double dt5 = dt4 * dt;
+            Q_[0][0] = q * dt5 / 20.0;
+            Q_[0][1] = q * dt4 / 8.0;
+            Q_[0][2] = q * dt3 / 6.0;
+            Q_[1][1] = q * dt3 / 3.0;
+            Q_[1][2] = q * dt2 / 2.0;
+            Q_[2][2] = q * dt;
+            Q_[1][0] = Q_[0][1];
+            Q_[2][0] = Q_[0][2];
+            Q_[2][1] = Q_[1][2];
+        }
+    }
+
+    template <int Order>
+    double SeamAxisKalman<Order>::Update(double z)
+    {
+        if (!init_) {
+            Init(z);
+        }
+        else {
+            Predict();
+            Correct(z);
+        }
+        return x_[0];
+    }
+
+    template <int Order>
+    void SeamAxisKalman<Order>::Reset()
+    {
+        x_ = {};
+        P_ = {};
+        init_ = false;
+    }
+
+    // 首个测量点：位置取测量值，高阶状态取零并给较大初始协方差
+    template <int Order>
+    void SeamAxisKalman<Order>::Init(double z)
+    {
+        x_ = {};
+        x_[0] = z;
+        P_ = {};
+        P_[0][0] = r_;
+        for (int i = 1; i < Order; ++i) {
+            P_[i][i] = MacroDefine::KalmanInitCov;
+        }
+        init_ = true;
+    }
+
+    // 预测步骤: x = F x, P = F P F' + Q
+    template <int Order>
+    void SeamAxisKalman<Order>::Predict()
+    {
+        State x = {};
+        for (int i = 0; i < Order; ++i) {
+            for (int j = 0; j < Order; ++j) {
+                x[i] += F_[i][j] * x_[j];
+            }
+        }
+        x_ = x;
+
+        Cov FP = {};
+        for (int i = 0; i < Order; ++i) {
+            for (int j = 0; j < Order; ++j) {
+                for (int k = 0; k < Order; ++k) {
+                    FP[i][j] += F_[i][k] * P_[k][j];
+                }
+            }
+        }
+        for (int i = 0; i < Order; ++i) {
+            for (int j = 0; j < Order; ++j) {
+                double sum = Q_[i][j];
+                for (int k = 0; k < Order; ++k) {
+                    sum += FP[i][k] * F_[j][k];
+                }
+                P_[i][j] = sum;
+            }
+        }
+    }
+
+    // 更新步骤（仅观测位置 H = [1, 0, ...]）
+    template <int Order>
+    void SeamAxisKalman<Order>::Correct(double z)
+    {
+        const double S = P_[0][0] + r_;
+        State K;
+        for (int i = 0; i < Order; ++i) {
+            K[i] = P_[i][0] / S;
+        }
+
+        const double innov = z - x_[0];
+        for (int i = 0; i < Order; ++i) {
+            x_[i] += K[i] * innov;
+        }
+
+        // P = (I - K H) P
+        const State P0 = P_[0];
+        for (int i = 0; i < Order; ++i) {
+            for (int j = 0; j < Order; ++j) {
+                P_[i][j] -= K[i] * P0[j];
+            }
+        }
+    }
+
+    template <int Order>
+    double SeamAxisKalman<Order>::Extrapolate(double horizon) const
+    {
+        double p = x_[0] + x_[1] * horizon;
+        if constexpr (Order == 3) {
+            p += 0.5 * x_[2] * horizon * horizon;
+        }
+        return p;
+    }
+
+    // 构造函数
+    template <int Order>
+    SeamKalmanTracker<Order>::SeamKalmanTracker(double dt, double PNoiseCov, double MNoiseCov)
+        : SeamKalmanTracker(dt, Point3d{ PNoiseCov, PNoiseCov, PNoiseCov },
+            Point3d{ MNoiseCov, MNoiseCov, MNoiseCov })
+    {
+    }
+
+    template <int Order>
+    SeamKalmanTracker<Order>::SeamKalmanTracker(double dt, const Point3d& PNoiseCov, const Point3d& MNoiseCov)
+        : axes_{ SeamAxisKalman<Order>(dt, PNoiseCov[0], MNoiseCov[0]),
+                 SeamAxisKalman<Order>(dt, PNoiseCov[1], MNoiseCov[1]),
+                 SeamAxisKalman<Order>(dt, PNoiseCov[2], MNoiseCov[2]) }
+    {
+    }
+
+    template <int Order>
+    void SeamKalmanTracker<Order>::Reset()
+    {
+        for (auto& axis : axes_) {
+            axis.Reset();
+        }
+        count_ = 0;
+        tail_.clear();
+        lastRows_ = 0;
+    }
+
+    template <int Order>
+    std::vector<double> SeamKalmanTracker<Order>::Update(const std::vector<double>& meaPt)
+    {
+        if (meaPt.size() < 3) {
+            return GetFilterPt();
+        }
+
+        for (int k = 0; k < 3; ++k) {
+            axes_[k].Update(meaPt[k]);
+        }
+        ++count_;
+
+        return GetFilterPt();
+    }
+
+    template <int Order>
+    std::vector<double> SeamKalmanTracker<Order>::mea_Pos_Filter(
+        const std::vector<std::vector<double>>& trackDatas_Save)
+    {
+        rows_.clear();
+        for (const auto& row : trackDatas_Save) {
+            if (row.size() >= 3) {
+                rows_.push_back(&row);
+            }
+        }
+        const size_t n = rows_.size();
+
+        // 窗口去掉末尾 d 个点后，其末尾与上次处理的点一致
+        const auto same = [](const std::vector<double>& row, const Point3d& pt) {
+            return row[0] == pt[0] && row[1] == pt[1] && row[2] == pt[2];
+        };
+        const auto aligned = [&](size_t d) {
+            const size_t m = tail_.size();
+            const size_t overlap = std::min(m, n - d);
+            for (size_t j = 0; j < overlap; ++j) {
+                if (!same(*rows_[n - 1 - d - j], tail_[m - 1 - j])) {
+                    return false;
+                }
+            }
+            return true;
+        };
+
+        // 新点数 d：窗口变长时为长度增量，否则至少为 1（停顿时内容不变但窗口已推进）；
+        // 只有找不到 d >= 1 且内容完全未变时才视为重复调用
+        size_t fresh = n;
+        if (!tail_.empty()) {
+            const size_t minFresh = (n > lastRows_) ? n - lastRows_ : 1;
+            for (size_t d = minFresh; d < n; ++d) {
+                if (aligned(d)) {
+                    fresh = d;
+                    break;
+                }
+            }
+            if (fresh == n && n <= lastRows_ && aligned(0)) {
+                fresh = 0;
+            }
+            if (fresh == n) {
+                Reset();  // 与已处理的点无法对齐：新焊缝
+            }
+        }
+        lastRows_ = n;
+
+        for (size_t i = n - fresh; i < n; ++i) {
+            const std::vector<double>& row = *rows_[i];
+            Update(row);
+            tail_.push_back({ row[0], row[1], row[2] });
+        }
+        if (tail_.size() > TailMatch) {
+            tail_.erase(tail_.begin(), tail_.end() - TailMatch);
+        }
+
+        return GetFilterPt();
+    }
+
+    template <int Order>
+    std::vector<double> SeamKalmanTracker<Order>::GetFilterPt() const
+    {
+        return { axes_[0].GetState()[0], axes_[1].GetState()[0], axes_[2].GetState()[0] };
+    }
+
+    template <int Order>
+    std::vector<double> SeamKalmanTracker<Order>::GetVelocity() const
+    {
+        return { axes_[0].GetState()[1], axes_[1].GetState()[1], axes_[2].GetState()[1] };
+    }
+
+    template <int Order>
+    std::vector<double> SeamKalmanTracker<Order>::Predict(double horizon) const
+    {
+        return {
+            axes_[0].Extrapolate(horizon),
+            axes_[1].Extrapolate(horizon),
+            axes_[2].Extrapolate(horizon)
+        };
+    }
+
+} // namespace WeldTrackApp
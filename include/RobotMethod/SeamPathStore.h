@@ -0,0 +1,82 @@
+#pragma once
+
+#include <vector>
+#include <array>
+#include <cstddef>
+#include <unordered_map>
+
+namespace WeldTrackApp {
+
+    /// @brief 按弧长索引的焊缝路径存储
+    /// 追加点时增量累计弧长，总长度与任意两点间弧长为 O(1)，按弧长取点为 O(log n)；
+    /// 最近点查询先从上次结果出发沿路径局部搜索，再以其距离为半径在均匀网格索引中校验，
+    /// 结果为全局最近点；焊接中逐周期查询时只检查邻近的几个网格，均摊 O(1)。
+    /// 旧数据可按弧长裁剪，裁剪只移动头部偏移，累计到一半容量时才整体搬移。
+    class SeamPathStore {
+    public:
+        using Point3d = std::array<double, 3>;
+        static constexpr double GridCell = 5.0;  // 最近点网格索引的单元边长 (mm)
+
+        /// @brief 构造函数
+        /// @param posOffset 输入行中位置 [x, y, z] 的起始下标（trackDatas_Save 的行为 5）
+        explicit SeamPathStore(size_t posOffset = 0);
+
+        /// @brief 追加一个点
+        /// @param row 数据行，位置取 row[posOffset .. posOffset + 2]
+        void Append(const std::vector<double>& row);
+
+        /// @brief 追加一个位置点 [x, y, z]
+        void AppendPoint(const Point3d& pt);
+
+        /// @brief 清空路径
+        void Clear();
+
+        /// @brief 当前保存的点数
+        size_t Size() const { return cumLen_.size() - head_; }
+        bool Empty() const { return Size() == 0; }
+
+        /// @brief 第 i 个保存的点（0 为最早的点）
+        const Point3d& operator[](size_t i) const;
+
+        /// @brief 第 i 个保存的点对应的弧长（自焊缝起点，含已裁剪部分）
+        double ArcLength(size_t i) const;
+
+        /// @brief 焊缝起点到最后一个点的总长度 (mm)，与 Cal_totalLength 结果一致
+        double TotalLength() const { return cumLen_.empty() ? 0.0 : cumLen_.back(); }
+
+        /// @brief 当前保存的第一个点对应的弧长
+        double StartLength() const { return Empty() ? 0.0 : cumLen_[head_]; }
+
+        /// @brief 按弧长取点，在相邻保存点之间线性插值，超出范围时取端点
+        /// @param s 自焊缝起点的弧长 (mm)
+        Point3d PointAt(double s) const;
+
+        /// @brief 距离给定位置最近的保存点下标
+        /// 从上次查询结果（或 hint）出发沿路径向距离减小的方向搜索，得到的距离作为半径在网格索引中
+        /// 查找更近的点（U 形或闭合焊缝、跳变、首次查询时局部搜索会停在局部极小值）；
+        /// 半径覆盖的网格数超过点数时改为逐点比较。
+        /// @param pos 查询位置 [x, y, z]
+        /// @return 最近点下标，路径为空时抛出异常
+        size_t NearestIndex(const Point3d& pos);
+        size_t NearestIndex(const Point3d& pos, size_t hint) const;
+
+        /// @brief 裁剪弧长小于 s 的点，保留 s 之前最近的一个点使 PointAt(s) 仍可插值
+        /// @return 裁剪的点数
+        size_t TrimBefore(double s);
+
+    private:
+        size_t posOffset_;
+        std::vector<Point3d> pts_;
+        std::vector<double> cumLen_;
+        size_t head_ = 0;
+        size_t lastNearest_ = 0;
+
+        // 网格索引：单元 -> 点的全局序号（pts_ 下标 + base_），已裁剪的点在搬移时移除
+        std::unordered_map<long long, std::vector<size_t>> grid_;
+        size_t base_ = 0;
+
+        static long long CellKey(long long ix, long long iy, long long iz);
+        void Compact();
+    };
+
+} // namespace WeldTrackApp
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <vector>
+#include <array>
+#include <cstddef>
+#include "WTrackDType.h"
+
+namespace WeldTrackApp {
+
+    /// @brief 焊缝测量点的流式卡尔曼滤波器
+    /// 与 TrackAlgMethod::mea_Pos_Filter 对同一测量序列逐位一致，但只保存滤波状态，
+    /// 每个新测量点增量更新，不再每次复制历史并从头重算。
+    ///
+    /// 批量版本把历史数据前补 filterDelay - n 个首点后滤波，增益序列只与协方差有关，
+    /// 新测量点到来时数据对应的增益整体前移一位。增益已收敛（逐位不变）的区段按 O(1) 递推；
+    /// 未收敛区段在至多 filterDelay 个点的定长缓存上重放，不分配内存。
+    /// 测量点数达到 filterDelay 后不再补点，直接按标准卡尔曼递推。
+    class SeamPosFilter {
+    public:
+        /// @brief 构造函数
+        /// @param MNoiseCov 测量噪声协方差
+        /// @param PNoiseCov 过程噪声协方差
+        SeamPosFilter(double MNoiseCov, double PNoiseCov);
+
+        /// @brief 输入一个新的测量点并返回滤波结果
+        /// @param meaPt 测量点 [x, y, z, ...]，不足3维的点被忽略（与批量版本一致）
+        /// @return 滤波后的点 [x, y, z]
+        std::vector<double> Update(const std::vector<double>& meaPt);
+
+        /// @brief 当前滤波结果
+        /// @return 滤波后的点 [x, y, z]，尚无测量点时返回 [0, 0, 0]
+        std::vector<double> GetFilterPt() const;
+
+        /// @brief 已输入的有效测量点数
+        size_t Count() const { return count_; }
+
+        /// @brief 清空滤波状态（协方差参数不变）
+        void Reset();
+
+    private:
+        using Point3d = std::array<double, 3>;
+        static constexpr int Delay = MacroDefine::filterDelay;
+
+        // 第 t 步 (t >= 1) 的卡尔曼增益，仅由协方差决定
+        std::array<double, Delay> gains_ = {};
+        // 增益自该步起逐位不变
+        int stableFrom_ = Delay;
+
+        // 补点阶段的测量缓存
+        std::array<Point3d, Delay> history_ = {};
+        size_t count_ = 0;
+
+        // 增益收敛区段的递推估计
+        Point3d fastEst_ = {};
+        // 不补点的标准卡尔曼递推（count_ >= Delay 时即为输出）
+        Point3d stdEst_ = {};
+        double stdCov_ = MacroDefine::KalmanInitCov;
+
+        double mNoiseCov_;
+        double pNoiseCov_;
+
+        Point3d output_ = {};
+
+        // 重放补点后的批量滤波
+        Point3d Replay() const;
+    };
+
+} // namespace WeldTrackApp
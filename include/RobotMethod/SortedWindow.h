@@ -0,0 +1,47 @@
+#pragma once
+
+#include <vector>
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+namespace WeldTrackApp {
+
+    /// @brief 定容量滑动有序窗口（HampelFilter 与 FilterPolicy::Median 共用）
+    /// 同时按到达顺序与数值顺序保存最近 capacity 个值：插入/删除用二分查找定位后整体搬移，
+    /// 中位数 O(1)，MAD 由中位数两侧的有序偏差归并得到。
+    /// N > 0 时容量在编译期确定、存储为定长数组；N = 0 时容量在构造时给定，存储一次分配。
+    template <size_t N = 0>
+    class SortedWindow {
+    public:
+        /// @brief 构造函数
+        /// @param capacity 窗口容量，N > 0 时必须等于 N
+        explicit SortedWindow(size_t capacity = N);
+
+        /// @brief 加入一个值，窗口已满时先移出最早的值
+        void Push(double value);
+
+        void Clear();
+
+        size_t Size() const { return size_; }
+        size_t Capacity() const { return ring_.size(); }
+
+        /// @brief 当前中位数（窗口不能为空）
+        double Median() const;
+
+        /// @brief 相对给定中位数的绝对偏差中位数（窗口不能为空）
+        double MedianAbsDev(double median) const;
+
+    private:
+        using Storage = std::conditional_t<N == 0, std::vector<double>, std::array<double, N>>;
+
+        Storage ring_ = {};    // 按到达顺序
+        Storage sorted_ = {};  // 按数值递增，前 size_ 个有效
+        size_t head_ = 0;
+        size_t size_ = 0;
+    };
+
+} // namespace WeldTrackApp
+
+// 实现模板类必须在头文件中
+#include "SortedWindow.inl"
@@ -0,0 +1,87 @@
+#include <cmath>
+#include <algorithm>
+#include <stdexcept>
+
+namespace WeldTrackApp {
+
+    template <size_t N>
+    SortedWindow<N>::SortedWindow(size_t capacity)
+    {
+        if constexpr (N == 0) {
+            if (capacity == 0) {
+                throw std::invalid_argument("window capacity must be bigger than 0");
+            }
+            ring_.assign(capacity, 0.0);
+            sorted_.assign(capacity, 0.0);
+        }
+        else if (capacity != N) {
+            throw std::invalid_argument("window capacity does not match N");
+        }
+    }
+
+    template <size_t N>
+    void SortedWindow<N>::Push(double value)
+    {
+        double* data = sorted_.data();
+        const size_t capacity = ring_.size();
+
+        // 窗口已满：删除最早的值
+        if (size_ == capacity) {
+            const double oldest = ring_[head_];
+            double* pos = std::lower_bound(data, data + size_, oldest);
+            std::copy(pos + 1, data + size_, pos);
+            --size_;
+            ring_[head_] = value;
+            head_ = (head_ + 1) % capacity;
+        }
+        else {
+            ring_[(head_ + size_) % capacity] = value;
+        }
+
+        // 插入新值
+        double* pos = std::upper_bound(data, data + size_, value);
+        std::copy_backward(pos, data + size_, data + size_ + 1);
+        *pos = value;
+        ++size_;
+    }
+
+    template <size_t N>
+    void SortedWindow<N>::Clear()
+    {
+        head_ = 0;
+        size_ = 0;
+    }
+
+    template <size_t N>
+    double SortedWindow<N>::Median() const
+    {
+        const size_t mid = size_ / 2;
+        return (size_ % 2) ? sorted_[mid] : (sorted_[mid - 1] + sorted_[mid]) / 2;
+    }
+
+    template <size_t N>
+    double SortedWindow<N>::MedianAbsDev(double median) const
+    {
+        // 中位数左侧偏差自右向左递增，右侧偏差自左向右递增，归并取第 k 小
+        size_t right = static_cast<size_t>(std::lower_bound(sorted_.begin(), sorted_.begin() + size_, median) - sorted_.begin());
+        size_t left = right;  // 左侧下一个候选为 left - 1
+        const size_t mid = size_ / 2;
+        double prev = 0.0;
+        double cur = 0.0;
+        for (size_t k = 0; k <= mid; ++k) {
+            const double dl = (left > 0) ? median - sorted_[left - 1] : HUGE_VAL;
+            const double dr = (right < size_) ? sorted_[right] - median : HUGE_VAL;
+            prev = cur;
+            if (dl <= dr) {
+                cur = dl;
+                --left;
+            }
+            else {
+                cur = dr;
+                ++right;
+            }
+        }
+        return (size_ % 2) ? cur : (prev + cur) / 2;
+    }
+
+} // namespace WeldTrackApp
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <vector>
+#include <cstddef>
+#include "WTrackDType.h"
+
+namespace WeldTrackApp {
+
+    /// @brief 沿焊缝弧长分段的焊接速度曲线
+    /// 每个分段从其起点弧长开始使用设定速度，相邻分段之间按最大加速度匀加减速过渡：
+    /// 降速在低速分段起点之前完成，升速在高速分段起点之后开始，因此进入低速区时已降到目标速度。
+    /// 分段可在焊接过程中随时修改（如按焊缝曲率、间隙调整），插补器按已走过的弧长查询。
+    class SpeedProfile {
+    public:
+        /// @brief 构造函数
+        /// @param baseSpeed 弧长 0 起的速度 (mm/s)
+        /// @param maxAcc 速度过渡的加速度 (mm/s^2)
+        explicit SpeedProfile(double baseSpeed = MacroDefine::WeldSpeed,
+            double maxAcc = MacroDefine::WeldMaxAcc);
+
+        /// @brief 自弧长 s 起使用速度 speed，清除 s 之后的全部分段
+        /// @param s 弧长 (mm)
+        /// @param speed 焊接速度 (mm/s)
+        void SetSpeed(double s, double speed);
+
+        /// @brief 区间 [s0, s1) 内使用速度 speed，s1 之后恢复原速度
+        void SetSpeedRange(double s0, double s1, double speed);
+
+        /// @brief 弧长 s 处的速度（含过渡）
+        double SpeedAt(double s) const;
+
+        /// @brief 弧长 s 处所在分段的设定速度（不含过渡）
+        double TargetAt(double s) const;
+
+        /// @brief 弧长 s 之后所有分段的最大设定速度
+        double MaxSpeedFrom(double s) const;
+
+        /// @brief 以最大加速度从 v0 过渡到 v1 所需的距离 (mm)
+        double RampDistance(double v0, double v1) const;
+
+        double MaxAcc() const { return maxAcc_; }
+        size_t Size() const { return zones_.size(); }
+
+    private:
+        struct Zone {
+            double s;      // 分段起点弧长
+            double speed;  // 设定速度
+        };
+
+        std::vector<Zone> zones_;  // 按起点弧长递增，zones_[0].s 恒为负无穷
+        double maxAcc_;
+
+        size_t ZoneIndex(double s) const;
+    };
+
+} // namespace WeldTrackApp
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <vector>
+#include <array>
+#include <cstddef>
+#include "RingBuffer.h"
+#include "RobotMethod/TrackAlgMethod.h"
+#include "RobotMethod/SpeedProfile.h"
+
+namespace WeldTrackApp {
+
+    /// @brief 前瞻样条插补规划器
+    /// 以流式输入的控制点为插值点构造均匀三次 B 样条（C2 连续，曲线经过每个控制点）：
+    /// de Boor 点由三对角方程 (P[i-1] + 4P[i] + P[i+1]) / 6 = Q[i] 的逆求得，逆的系数按 (2 - √3)^k 衰减，
+    /// 取前后 LookAhead 个控制点计算（截断误差远小于 0.001mm）。首尾控制点以端点为中心反射延拓（自然端点，
+    /// 直线上不产生超调），曲线起止于首末点。
+    /// 因此样条段比最新控制点滞后 LookAhead 个点生成。
+    /// 按弧长匀速、限制加速度生成 10ms 插补增量，拐角处由样条平滑过渡并按曲率限速，不再依赖控制器自行平滑。
+    /// 前瞻余量保证在已知路径内总能减速停止；Finish() 时沿剩余路径减速并精确停在最后一个控制点。
+    class SplinePlanner {
+    public:
+        using Point3d = std::array<double, 3>;
+        static constexpr size_t SegCapacity = 64;   // 待执行样条段的最大数量
+        static constexpr int SegSampleNum = 32;     // 每段弧长表的采样数
+        static constexpr int LookAhead = 8;         // 求 de Boor 点时每侧使用的控制点数
+
+        /// @brief 构造函数
+        /// @param totalLen 焊缝总长度 (mm)，用于按弧长分配姿态增量
+        /// @param totalIncAtt 总姿态增量 [Δrx, Δry, Δrz] (度)
+        /// @param speed 焊接速度 (mm/s)
+        /// @param maxAcc 最大加速度 (mm/s^2)
+        SplinePlanner(double totalLen, const std::vector<double>& totalIncAtt,
+            double speed = MacroDefine::WeldSpeed, double maxAcc = MacroDefine::WeldMaxAcc);
+
+        /// @brief 开始新焊缝
+        void Reset(double totalLen, const std::vector<double>& totalIncAtt);
+
+        /// @brief 设置焊接速度（自当前位置起生效，按加速度限制过渡）
+        /// @param speed 焊接速度 (mm/s)
+        void SetSpeed(double speed);
+
+        /// @brief 设置沿样条弧长的速度曲线，替换构造时的恒定速度
+        void SetSpeedProfile(const SpeedProfile& profile);
+
+        /// @brief 当前速度曲线
+        const SpeedProfile& GetSpeedProfile() const { return profile_; }
+
+        /// @brief 输入一个控制点，生成前瞻余量之外的插补增量
+        /// @param pt 控制点 [x, y, z, ...]，距上一控制点过近的点被跳过
+        /// @param incDatas [out] 插补增量追加到末尾 [Δx, Δy, Δz, Δrx, Δry, Δrz]
+        /// @return 本次生成的插补增量个数
+        size_t PushPoint(const std::vector<double>& pt, std::vector<IncPt>& incDatas);
+
+        /// @brief 控制点输入结束，减速并停在最后一个控制点
+        /// @param incDatas [out] 插补增量追加到末尾
+        /// @return 本次生成的插补增量个数
+        size_t Finish(std::vector<IncPt>& incDatas);
+
+        /// @brief 当前速度 (mm/s)
+        double CurSpeed() const { return curSpeed_; }
+
+        /// @brief 已执行的样条弧长 (mm)
+        double PlannedLength() const { return plannedLen_; }
+
+        /// @brief 已规划但尚未执行的样条弧长 (mm)
+        double RemainLength() const { return knownLen_ - plannedLen_; }
+
+        /// @brief 当前指令位置 [x, y, z]（以增量累加，与下发给机器人的位置一致）
+        std::vector<double> CurPos() const;
+
+    private:
+        struct Segment {
+            std::array<Point3d, 4> ctrl = {};
+            std::array<double, SegSampleNum + 1> arcLen = {};  // 采样点处的累计弧长
+            double startLen = 0.0;                             // 段起点对应的总弧长
+            double vLimit = 0.0;                               // 曲率限速 (mm/s)
+        };
+
+        TrackAlgMethod alg_;
+        double totalLen_ = 0.0;
+        std::array<double, 3> totalIncAtt_ = {};
+        SpeedProfile profile_;
+        double maxAcc_;
+
+        // 最近 2 * LookAhead + 1 个控制点（插值点）与最近4个 de Boor 点
+        RingBuffer<Point3d, 2 * LookAhead + 1> dataPts_;
+        RingBuffer<Point3d, 4> ctrlPts_;
+        std::vector<double> lastPt_;
+        size_t ptCount_ = 0;
+        long long nextBoor_ = -1;  // 下一个待求 de Boor 点的序号（-1 为首点之前的延拓点）
+        bool finished_ = false;
+
+        RingBuffer<Segment, SegCapacity> segs_;
+        double knownLen_ = 0.0;
+        double plannedLen_ = 0.0;
+        double curSpeed_ = 0.0;
+
+        // 已下发增量的累计值（整数单位）与起点
+        Point3d origin_ = {};
+        long long emitted_[6] = { 0, 0, 0, 0, 0, 0 };
+
+        Point3d DataPoint(long long m) const;
+        Point3d DeBoorPoint(long long j) const;
+        size_t AppendDeBoorPts(long long last, std::vector<IncPt>& incDatas);
+        void AppendCtrlPt(const Point3d& pt);
+        void AppendSegment();
+        size_t Plan(bool toEnd, std::vector<IncPt>& incDatas);
+        Point3d Evaluate(double s) const;
+        double BrakeSpeed(double dist, double vEnd) const;
+        void EmitCycle(std::vector<IncPt>& incDatas);
+    };
+
+} // namespace WeldTrackApp
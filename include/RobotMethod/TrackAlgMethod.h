@@ -1,84 +1,150 @@
 #pragma once
 
 #include <vector>
+#include <array>
 #include "ImageMethod/Matrix.h"
 #include "WTrackDType.h"
 
 namespace WeldTrackApp {
+    /// @brief 插补增量各轴的量化余量 [x, y, z, rx, ry, rz]
+    using IncResidual = std::array<double, 6>;
+
     class TrackAlgMethod {
     public:
-        /// @brief ʾ̹켣(̬)㺸쳤Ⱥͻ̬ı仯
-        /// @param mea_Pos 㼯 [[x, y, z, rx, ry, rz], ...] -> ʾ̹켣
-        /// @param IncAtt [out] ̬Ƕб [[rx, ry, rz], ...] ()
-        /// @param totalLen [out] ܳ (mm)
-        /// @return ɹ true false
+        /// @brief 根据示教轨迹(含姿态)计算焊缝长度和机器人姿态的变化，并清零批量插补的量化余量（新焊缝）
+        /// @param mea_Pos 测量点集合 [[x, y, z, rx, ry, rz], ...] -> 即示教轨迹
+        /// @param IncAtt [out] 姿态角度增量列表 [[Δrx, Δry, Δrz], ...] (度)
+        /// @param totalLen [out] 焊缝总长度 (mm)
+        /// @return 计算成功返回 true，否则 false
         bool Cal_WeldPara(const std::vector<std::vector<double>>& mea_Pos,
             std::vector<double>& IncAtt,
             double& totalLen);
 
-        /// @brief ʾ̸м̬Ƕȵ
-        /// @param Start ʼǶ ()
-        /// @param End Ƕ ()
-        /// @return Ƕ ()
+        /// @brief 示教跟踪中计算姿态角度的增量
+        /// @param Start 起始角度 (度)
+        /// @param End 结束角度 (度)
+        /// @return 角度增量 (度)
         double Cal_IncAtt(double Start, double End);
 
-        /// @brief ֮ŷϾ
-        /// @param firstPt һ [x, y, z]
-        /// @param secondPt ڶ [x, y, z]
-        /// @return  (mm)
+        /// @brief 计算两点之间的欧氏距离
+        /// @param firstPt 第一点 [x, y, z]
+        /// @param secondPt 第二点 [x, y, z]
+        /// @return 两点距离 (mm)
         double Cal_Length(const std::vector<double>& firstPt,
             const std::vector<double>& secondPt);
 
-        /// @brief ٳм岹
-        /// @param firstPt ʼ [x, y, z]
-        /// @param secondPt  [x, y, z]
-        /// @param TotalLen ܳ (mm)
-        /// @param TotalIncAtt ̬ [rx, ry, rz] ()
-        /// @return 岹㼯 [x, y, z, rx, ry, rz] (λ: mm/0.001, /0.0001)
+        /// @brief 跟踪程序中计算插补点（单段截断取整、Z轴增量为0的旧算法，保留用于兼容）
+        /// @param firstPt 起始点 [x, y, z]
+        /// @param secondPt 结束点 [x, y, z]
+        /// @param TotalLen 焊缝总长度 (mm)
+        /// @param TotalIncAtt 总姿态增量 [Δrx, Δry, Δrz] (度)
+        /// @return 插补点集合 [Δx, Δy, Δz, Δrx, Δry, Δrz] (单位: mm/0.001, 度/0.0001)
         std::vector<std::vector<int>> Cal_InterPt(
             const std::vector<double>& firstPt,
             const std::vector<double>& secondPt,
             double TotalLen,
             const std::vector<double>& TotalIncAtt);
 
-        /// @brief 㺸вܳ
-        /// @param trackDatas_Save ĸ [x, y, z, ...]
-        /// @return 켣ܳ (mm)
+        /// @brief 跟踪程序中计算插补点（直接写入连续的增量缓冲区）
+        /// @param firstPt 起始点 [x, y, z]
+        /// @param secondPt 结束点 [x, y, z]
+        /// @param TotalLen 焊缝总长度 (mm)
+        /// @param TotalIncAtt 总姿态增量 [Δrx, Δry, Δrz] (度)
+        /// @param Inter_Pts [out] 插补增量追加到末尾，每个增量不单独分配内存
+        /// @return 本次生成的插补点个数
+        size_t Cal_InterPt(
+            const std::vector<double>& firstPt,
+            const std::vector<double>& secondPt,
+            double TotalLen,
+            const std::vector<double>& TotalIncAtt,
+            std::vector<IncPt>& Inter_Pts);
+
+        /// @brief 跟踪程序中计算插补点（误差扩散，携带量化余量）
+        /// 每个插补周期的增量按累计值取整，不足一个单位的余量跨周期、跨段累积，
+        /// 连续多段插补的增量总和精确落在目标位置上；Z轴按实际增量插补。
+        /// @param firstPt 起始点 [x, y, z]
+        /// @param secondPt 结束点 [x, y, z]
+        /// @param TotalLen 焊缝总长度 (mm)
+        /// @param TotalIncAtt 总姿态增量 [Δrx, Δry, Δrz] (度)
+        /// @param residual [in/out] 各轴量化余量（单位: mm/0.001, 度/0.0001），新焊缝开始时置零
+        /// @param Inter_Pts [out] 插补增量追加到末尾
+        /// @return 本次生成的插补点个数
+        size_t Cal_InterPt(
+            const std::vector<double>& firstPt,
+            const std::vector<double>& secondPt,
+            double TotalLen,
+            const std::vector<double>& TotalIncAtt,
+            IncResidual& residual,
+            std::vector<IncPt>& Inter_Pts);
+
+        /// @brief 计算焊缝过程中测量的总长度
+        /// 每次调用遍历全部历史，焊接过程中需反复查询时使用 SeamPathStore 增量维护
+        /// @param trackDatas_Save 保存的跟踪数据，第 5-7 个元素为位置 [x, y, z]
+        /// @return 轨迹总长度 (mm)
         double Cal_totalLength(const std::vector<std::vector<double>>& trackDatas_Save);
 
-        /// @brief 켣岹
-        /// @param In_trackDatas_Control [in/out] /켣
-        /// @param totalLen ܳ (mm)
-        /// @param totalIncAtt ̬ [rx, ry, rz] ()
-        /// @return 岹ݼ [x, y, z, rx, ry, rz]
+        /// @brief 生成批量轨迹插补数据
+        /// 各段按误差扩散插补，量化余量保存在成员中跨段、跨批次携带，新焊缝开始时清零
+        /// @param In_trackDatas_Control [in/out] 输入/输出轨迹数据
+        /// @param totalLen 焊缝总长度 (mm)
+        /// @param totalIncAtt 总姿态增量 [Δrx, Δry, Δrz] (度)
+        /// @return 插补数据集 [Δx, Δy, Δz, Δrx, Δry, Δrz]
         std::vector<std::vector<int>> Gen_BatchTrackIncPtData(
             std::vector<std::vector<double>>& In_trackDatas_Control,
             double totalLen,
             const std::vector<double>& totalIncAtt);
 
-        /// @brief ж֮ǷҪ岹
-        /// @param firstPt һ [x, y, z, ...]
-        /// @param secondPt ڶ [x, y, z, ...]
-        /// @return Ҫ岹 true false
+        /// @brief 生成批量轨迹插补数据（直接写入连续的增量缓冲区）
+        /// @param In_trackDatas_Control [in/out] 输入/输出轨迹数据
+        /// @param totalLen 焊缝总长度 (mm)
+        /// @param totalIncAtt 总姿态增量 [Δrx, Δry, Δrz] (度)
+        /// @param all_IncDatas [out] 插补增量追加到末尾
+        /// @return 本次生成的插补点个数
+        size_t Gen_BatchTrackIncPtData(
+            std::vector<std::vector<double>>& In_trackDatas_Control,
+            double totalLen,
+            const std::vector<double>& totalIncAtt,
+            std::vector<IncPt>& all_IncDatas);
+
+        /// @brief 设置插补使用的焊接速度，默认为 MacroDefine::WeldSpeed
+        /// @param speed 焊接速度 (mm/s)
+        void SetWeldSpeed(double speed);
+
+        /// @brief 当前插补使用的焊接速度 (mm/s)
+        double GetWeldSpeed() const { return weldSpeed_; }
+
+        /// @brief 清零 Gen_BatchTrackIncPtData 的量化余量，新焊缝开始时调用（Cal_WeldPara 已包含）
+        void ResetResidual() { residual_ = {}; }
+
+        /// @brief Gen_BatchTrackIncPtData 当前的量化余量（单位: mm/0.001, 度/0.0001）
+        const IncResidual& Residual() const { return residual_; }
+
+        /// @brief 判断两点之间是否需要插补
+        /// @param firstPt 第一点 [x, y, z, ...]
+        /// @param secondPt 第二点 [x, y, z, ...]
+        /// @return 需要插补返回 true，否则 false
         bool Inter_Decision(const std::vector<double>& firstPt,
             const std::vector<double>& secondPt);
 
-        /// @brief ˲
-        /// @param trackDatas_Save ԭʼݼ
-        /// @param MNoiseCov Э
-        /// @param PNoiseCov Э
-        /// @return ˲ĵ [x, y, z]
+        /// @brief 卡尔曼滤波处理测量数据
+        /// @param trackDatas_Save 原始测量数据集合
+        /// @param MNoiseCov 测量噪声协方差
+        /// @param PNoiseCov 过程噪声协方差
+        /// @return 滤波后的点 [x, y, z]
         std::vector<double> mea_Pos_Filter(
             const std::vector<std::vector<double>>& trackDatas_Save,
             double MNoiseCov,
             double PNoiseCov);
 
     private:
-        /// @brief ˲ʵ
-        /// @param ilv_MeasureDatas 
-        /// @param idv_MNoiseCov Э
-        /// @param idv_PNoiseCov Э
-        /// @return ˲
+        double weldSpeed_ = MacroDefine::WeldSpeed;
+        IncResidual residual_ = {};  // 批量插补的量化余量
+
+        /// @brief 卡尔曼滤波器实现
+        /// @param ilv_MeasureDatas 测量数据数组
+        /// @param idv_MNoiseCov 测量噪声协方差
+        /// @param idv_PNoiseCov 过程噪声协方差
+        /// @return 滤波后的数据数组
         std::vector<double> Cal_KalmanFilter(
             const std::vector<double>& ilv_MeasureDatas,
             double idv_MNoiseCov,
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <vector>
+#include <array>
+#include <cstddef>
+#include "RingBuffer.h"
+#include "RobotMethod/TrackAlgMethod.h"
+#include "RobotMethod/SpeedProfile.h"
+
+namespace WeldTrackApp {
+
+    /// @brief 流式轨迹插补器
+    /// 控制点逐个输入，满足插补条件（Inter_Decision）即立即生成该段插补增量；
+    /// 距离过近的点被跳过。增量量化余量跨段携带，累计增量精确落在控制点上。已接受的控制点保存在定容环形缓冲区中，
+    /// 不再像 Gen_BatchTrackIncPtData 那样复制可行点集并擦除调用方的历史数据。
+    /// 每段插补速度取速度曲线在该段起点弧长处的值，默认恒为 MacroDefine::WeldSpeed。
+    class TrackInterpolator {
+    public:
+        using Point3d = std::array<double, 3>;
+        static constexpr size_t CtrlPtCapacity = 64;  // 保留的已接受控制点数
+
+        /// @brief 构造函数
+        /// @param totalLen 焊缝总长度 (mm)
+        /// @param totalIncAtt 总姿态增量 [Δrx, Δry, Δrz] (度)
+        TrackInterpolator(double totalLen, const std::vector<double>& totalIncAtt);
+
+        /// @brief 开始新焊缝，清空控制点（速度曲线保持不变）
+        /// @param totalLen 焊缝总长度 (mm)
+        /// @param totalIncAtt 总姿态增量 [Δrx, Δry, Δrz] (度)
+        void Reset(double totalLen, const std::vector<double>& totalIncAtt);
+
+        /// @brief 输入一个控制点
+        /// @param pt 控制点 [x, y, z, ...]
+        /// @param incDatas [out] 新生成的插补增量直接追加到末尾 [Δx, Δy, Δz, Δrx, Δry, Δrz]
+        /// @return 本次生成的插补增量个数
+        size_t PushPoint(const std::vector<double>& pt, std::vector<IncPt>& incDatas);
+
+        /// @brief 设置沿焊缝弧长的速度曲线
+        void SetSpeedProfile(const SpeedProfile& profile) { profile_ = profile; }
+
+        /// @brief 当前速度曲线
+        const SpeedProfile& GetSpeedProfile() const { return profile_; }
+
+        /// @brief 焊接中修改速度：降速时在过渡距离之后达到新速度，升速时自当前位置开始加速
+        /// @param speed 焊接速度 (mm/s)
+        void SetWeldSpeed(double speed);
+
+        /// @brief 已插补的路径长度 (mm)
+        double Travelled() const { return travelled_; }
+
+        /// @brief 已接受的控制点（最早的在前，超出容量时覆盖最早的点）
+        const RingBuffer<Point3d, CtrlPtCapacity>& CtrlPts() const { return ctrlPts_; }
+
+        /// @brief 因距离过近被跳过的控制点数
+        size_t DroppedPts() const { return droppedPts_; }
+
+        /// @brief 当前量化余量（单位: mm/0.001, 度/0.0001）
+        const IncResidual& Residual() const { return residual_; }
+
+    private:
+        TrackAlgMethod alg_;
+        double totalLen_ = 0.0;
+        std::vector<double> totalIncAtt_;
+
+        // 最近一个已接受的控制点（插补段起点）
+        std::vector<double> anchor_;
+        bool hasAnchor_ = false;
+
+        IncResidual residual_ = {};
+
+        SpeedProfile profile_;
+        double travelled_ = 0.0;
+
+        RingBuffer<Point3d, CtrlPtCapacity> ctrlPts_;
+        size_t droppedPts_ = 0;
+    };
+
+} // namespace WeldTrackApp
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <vector>
+#include <array>
+#include <memory>
+#include <functional>
+#include <cstddef>
+#include "RingBuffer.h"
+#include "WTrackDType.h"
+
+namespace WeldTrackApp {
+
+    class LaserCoordToTcp;
+    class WorkStealingPool;
+
+    /// @brief 录制的单帧焊缝数据
+    struct SimFrame {
+        double r = 0.0;                // 焊缝特征点像素行坐标
+        double c = 0.0;                // 焊缝特征点像素列坐标
+        std::vector<double> FLPPoint;  // 采集时法兰盘位姿 [x, y, z, rz, ry, rx]
+    };
+
+    /// @brief 一次焊接的录制数据
+    struct SimRecording {
+        std::vector<SimFrame> frames;               // 按采集顺序
+        double totalLen = 1.0;                      // 示教焊缝总长度 (mm)
+        std::vector<double> totalIncAtt = { 0.0, 0.0, 0.0 };  // 总姿态增量 [Δrx, Δry, Δrz] (度)
+        std::vector<std::array<double, 3>> refPath; // 焊缝真值路径，为空时以未滤波的测量点为参考
+    };
+
+    /// @brief 仿真参数
+    struct SimConfig {
+        double framePeriod = MacroDefine::InterCycle;  // 相机帧周期 (s)
+        double commPeriod = MacroDefine::InterCycle;   // 与控制器的通讯周期 (s)
+        double weldSpeed = MacroDefine::WeldSpeed;     // 焊接速度 (mm/s)
+        double MNoiseCov = 0.1;                        // 卡尔曼测量噪声协方差
+        double PNoiseCov = 0.01;                       // 卡尔曼过程噪声协方差
+        size_t queueCapacity = MacroDefine::Motoman_Queue_MCount;  // 控制器增量队列容量
+        size_t sendBatch = MacroDefine::IncData_Count;             // 单次通讯下发的增量数
+        size_t startQueue = MacroDefine::IncData_Count;            // 控制器开始执行前队列需积累的增量数
+        size_t hampelWindow = 0;                       // 滤波前 Hampel 离群点剔除的窗口长度，0 为不启用
+        double hampelSigma = 3.0;                      // Hampel 判定阈值倍数
+    };
+
+    /// @brief 仿真结果
+    struct SimResult {
+        size_t frames = 0;         // 处理的帧数
+        size_t incCount = 0;       // 控制器执行的插补增量数
+        size_t underruns = 0;      // 跟踪开始后控制器队列为空的插补周期数
+        size_t maxQueue = 0;       // 控制器队列的最大深度
+        double simTime = 0.0;      // 仿真时长 (s)
+        double wallTime = 0.0;     // 实际耗时 (s)
+        double pathLength = 0.0;   // 焊枪走过的路程 (mm)
+        double maxErr = 0.0;       // 焊枪到参考路径的最大距离 (mm)
+        double rmsErr = 0.0;       // 焊枪到参考路径距离的均方根 (mm)
+        size_t rejected = 0;       // Hampel 判为离群并替换的测量点数
+
+        /// @brief 每秒处理的帧数
+        double FramesPerSec() const { return wallTime > 0 ? frames / wallTime : 0.0; }
+        /// @brief 仿真时长与实际耗时之比
+        double RealTimeFactor() const { return wallTime > 0 ? simTime / wallTime : 0.0; }
+    };
+
+    /// @brief 离线跟踪仿真（TrackStatus::Sim_Start / Sim_Run）
+    /// 录制的焊缝像素与法兰盘位姿按帧周期依次经过 LaserCoordToTcp（像素 -> 基坐标系）、
+    /// HampelFilter（可选的离群点剔除）、SeamPosFilter（与 mea_Pos_Filter 一致的卡尔曼滤波，
+    /// 可替换为任意点滤波器）和 TrackInterpolator（TrackAlgMethod 插补），
+    /// 生成的增量按通讯周期成批下发到模拟的控制器队列，控制器每个插补周期执行一个增量。
+    /// 仿真时钟与实际时间无关，按 CPU 能力尽快运行；焊枪从第一个滤波点出发，逐周期统计到参考路径的误差。
+    class TrackSimulator {
+    public:
+        static constexpr size_t QueueMaxCapacity = 1024;  // 控制器队列容量上限
+
+        explicit TrackSimulator(const SimConfig& config = SimConfig());
+        ~TrackSimulator();
+
+        // 禁止拷贝和赋值
+        TrackSimulator(const TrackSimulator&) = delete;
+        TrackSimulator& operator=(const TrackSimulator&) = delete;
+
+        /// @brief 仿真一次焊接（SeamPosFilter 滤波）
+        /// @param recording 录制数据
+        /// @return 仿真结果
+        SimResult Run(const SimRecording& recording);
+
+        /// @brief 以指定的滤波器仿真一次焊接，用于比较不同的滤波方案
+        /// @tparam Filter 提供 std::vector<double> Update(const std::vector<double>&) 的点滤波器，
+        /// 如 SeamPosFilter、SeamCVTracker、AxisFilter<FilterChain<...>>
+        /// @param recording 录制数据
+        /// @param filter 滤波器，状态由调用方管理（不重置）
+        /// @return 仿真结果
+        template <typename Filter>
+        SimResult Run(const SimRecording& recording, Filter& filter)
+        {
+            return RunImpl(recording, [&filter](const std::vector<double>& pt) { return filter.Update(pt); });
+        }
+
+        /// @brief 并行仿真多次焊接，每个任务使用独立的仿真器
+        /// @param recordings 录制数据
+        /// @param config 仿真参数
+        /// @param pool 线程池
+        /// @return 与输入同序的仿真结果
+        static std::vector<SimResult> RunBatch(const std::vector<SimRecording>& recordings,
+            const SimConfig& config, WorkStealingPool& pool);
+
+        /// @brief 仿真状态：Run 开始时为 Sim_Start，进入仿真循环后为 Sim_Run，结束后为 Track_null
+        TrackStatus Status() const { return status_; }
+
+        const SimConfig& Config() const { return config_; }
+
+    private:
+        using PointFilter = std::function<std::vector<double>(const std::vector<double>&)>;
+
+        SimConfig config_;
+        std::unique_ptr<LaserCoordToTcp> converter_;
+        RingBuffer<IncPt, QueueMaxCapacity> queue_;
+        TrackStatus status_ = TrackStatus::Track_null;
+
+        SimResult RunImpl(const SimRecording& recording, const PointFilter& filter);
+    };
+
+} // namespace WeldTrackApp
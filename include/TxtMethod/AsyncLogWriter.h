@@ -0,0 +1,104 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <fstream>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstddef>
+#include <initializer_list>
+
+/** 日志队列满时的处理方式 */
+enum class OverflowPolicy {
+	Block,       // 等待后台线程腾出空间
+	DropOldest,  // 丢弃最早的记录后写入
+	DropNewest   // 丢弃当前记录，仅计数
+};
+
+/** 单条日志记录：最多 MaxCols 个数值 */
+struct LogRecord {
+	static constexpr size_t MaxCols = 8;
+	double values[MaxCols];
+	uint32_t count;
+};
+
+/**
+ * 异步文本日志写入
+ * 生产者把记录写入定容无锁环形队列（多生产者/多消费者，按序号判定槽位状态），
+ * 热路径只有一次位置递增与记录拷贝，不加锁、不分配内存、不做格式化与磁盘 I/O；
+ * 后台线程批量取出记录，按 WriteTxt 的格式（"0000.00"）格式化后写入文件。
+ */
+class AsyncLogWriter {
+public:
+	/**
+	 * @param FileName 输出文件路径，无法创建时抛出 std::runtime_error
+	 * @param capacity 队列容量，向上取 2 的幂
+	 * @param policy 队列满时的处理方式
+	 * @param idleWaitMs 队列为空时后台线程的等待时间 (ms)
+	 */
+	explicit AsyncLogWriter(const std::string& FileName, size_t capacity = 8192,
+		OverflowPolicy policy = OverflowPolicy::DropNewest, int idleWaitMs = 2);
+
+	/** 写出队列中剩余的记录后关闭文件 */
+	~AsyncLogWriter();
+
+	AsyncLogWriter(const AsyncLogWriter&) = delete;
+	AsyncLogWriter& operator=(const AsyncLogWriter&) = delete;
+
+	/**
+	 * 追加一条记录（可由多个线程同时调用）
+	 * @param values 数值，超过 LogRecord::MaxCols 的部分被截断
+	 * @param count 数值个数
+	 * @return 记录已入队返回 true；DropNewest 策略下队列已满返回 false
+	 */
+	bool Log(const double* values, size_t count);
+	bool Log(const std::vector<double>& values) { return Log(values.data(), values.size()); }
+	bool Log(std::initializer_list<double> values) { return Log(values.begin(), values.size()); }
+
+	/** 等待调用前入队的记录全部写入文件 */
+	void Flush();
+
+	/** 已写入文件的记录数 */
+	uint64_t Written() const { return written_.load(std::memory_order_relaxed); }
+
+	/** 因队列已满被丢弃的记录数 */
+	uint64_t Dropped() const { return dropped_.load(std::memory_order_relaxed); }
+
+	size_t Capacity() const { return mask_ + 1; }
+	OverflowPolicy Policy() const { return policy_; }
+
+private:
+	struct Slot {
+		std::atomic<size_t> seq;
+		LogRecord rec;
+	};
+
+	std::unique_ptr<Slot[]> slots_;
+	size_t mask_;
+	OverflowPolicy policy_;
+
+	// 生产者与消费者的位置分处不同缓存行
+	alignas(64) std::atomic<size_t> tail_{ 0 };
+	alignas(64) std::atomic<size_t> head_{ 0 };
+	alignas(64) std::atomic<uint64_t> written_{ 0 };
+	std::atomic<uint64_t> dropped_{ 0 };
+
+	std::ofstream file_;
+	std::chrono::milliseconds idleWait_;
+	std::thread worker_;
+	std::mutex mutex_;
+	std::condition_variable cv_;       // 唤醒后台线程
+	std::condition_variable doneCv_;   // 通知 Flush
+	size_t donePos_ = 0;               // 此位置之前的记录均已写入或丢弃
+	bool flushReq_ = false;
+	bool stop_ = false;
+
+	bool TryPush(const double* values, size_t count);
+	bool TryPop(LogRecord& rec);
+	void WorkerLoop();
+};
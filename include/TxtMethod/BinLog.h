@@ -0,0 +1,128 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <fstream>
+#include <cstdint>
+#include <cstddef>
+#include "MappedFile.h"
+#include "TxtMethod/TxtMethod.h"
+
+/**
+ * 二进制列式跟踪日志
+ *
+ * 文件布局（小端，版本 2）：
+ *   文件头  magic "WTLG" | uint16 版本 | uint16 列数 | uint32 每块行数 | uint32 文件头字节数
+ *           | uint64 总行数 | uint64 标定哈希 | uint64 索引位置
+ *           | 列描述 [uint8 类型, uint8 编码, uint8 列名长度, 列名] ...，补齐到 8 字节
+ *   数据块  每块 chunkRows 行（最后一块可不足），块内按列连续存放，每列补齐到 8 字节；
+ *           Raw 列为原始数值，Delta / Delta2 列为 VarintCodec 编码
+ *   索引    每块每列的起始位置 uint64[块数 * 列数]，最后附数据区结束位置
+ * 版本 1 没有编码字节与索引（文件头 32 字节），各列均为原始数值，仍可读取。
+ */
+namespace BinLog {
+	constexpr char Magic[4] = { 'W', 'T', 'L', 'G' };
+	constexpr uint16_t Version = 2;
+	constexpr uint32_t DefaultChunkRows = 65536;
+
+	/**
+	 * 标定参数的 64 位 FNV-1a 哈希，写入文件头以识别日志对应的标定结果
+	 * @param params 标定参数（如手眼标定结果、相机内参）
+	 */
+	uint64_t HashCalibration(const std::vector<double>& params);
+}
+
+/**
+ * 二进制列式日志写入
+ * 数据按块缓存在内存中，每满一块写出一次；Close（或析构）时写出最后一块并回填总行数。
+ */
+class BinLogWriter {
+public:
+	/**
+	 * @param FileName 输出文件路径，无法创建时抛出 std::runtime_error
+	 * @param schema 列定义
+	 * @param calibHash 标定哈希
+	 * @param chunkRows 每块行数
+	 */
+	BinLogWriter(const std::string& FileName, const ColumnSchema& schema,
+		uint64_t calibHash = 0, uint32_t chunkRows = BinLog::DefaultChunkRows);
+	~BinLogWriter();
+
+	BinLogWriter(const BinLogWriter&) = delete;
+	BinLogWriter& operator=(const BinLogWriter&) = delete;
+
+	/** 追加一行，个数须与列数相同 */
+	void AppendRow(const std::vector<double>& row);
+
+	/** 追加一个列存储表的全部行，列定义须一致 */
+	void Append(const ColumnTable& table);
+
+	/** 写出剩余数据并关闭文件 */
+	void Close();
+
+	/** 已追加的行数 */
+	uint64_t Rows() const { return rows_; }
+
+private:
+	std::ofstream file_;
+	ColumnSchema schema_;
+	uint32_t chunkRows_;
+	std::vector<std::vector<char>> chunkCols_;  // 当前块各列的原始字节
+	uint32_t chunkFill_ = 0;
+	uint64_t rows_ = 0;
+	uint64_t offset_ = 0;                       // 已写出的字节数
+	std::vector<uint64_t> index_;               // 各块各列的起始位置
+	std::vector<char> encoded_;                 // 编码缓冲区
+	bool closed_ = false;
+
+	void FlushChunk();
+};
+
+/**
+ * 二进制列式日志读取（内存映射）
+ * 打开时只解析文件头与索引，数据在访问时按页调入，数 GB 的日志也可立即打开。
+ * Raw 列零拷贝访问；编码列按块解码到内部缓存，因此同一读取对象不可在多个线程间共享。
+ */
+class BinLogReader {
+public:
+	/**
+	 * @param FileName 日志文件路径，文件无法映射或格式错误时抛出 std::runtime_error
+	 */
+	explicit BinLogReader(const std::string& FileName);
+
+	const ColumnSchema& Schema() const { return schema_; }
+	uint16_t Version() const { return version_; }
+	uint64_t CalibHash() const { return calibHash_; }
+	uint64_t Rows() const { return rows_; }
+	uint32_t ChunkRows() const { return chunkRows_; }
+	size_t ChunkCount() const { return static_cast<size_t>((rows_ + chunkRows_ - 1) / chunkRows_); }
+
+	/**
+	 * 第 chunk 块中第 col 列的数据
+	 * Raw 列的指针直接指向映射内存；编码列指向解码缓存，在下次访问该列的其他块前有效
+	 * @param rows [out] 本块行数
+	 * 列类型不符或下标越界时抛出异常，编码数据损坏时抛出 std::runtime_error
+	 */
+	const double* Float64Chunk(size_t col, size_t chunk, size_t& rows) const;
+	const int32_t* Int32Chunk(size_t col, size_t chunk, size_t& rows) const;
+
+	/** 第 row 行第 col 列的值（int32 列转换为 double） */
+	double Value(uint64_t row, size_t col) const;
+
+	/** 复制全部数据到列存储表 */
+	ColumnTable ReadAll() const;
+
+private:
+	WeldTrackApp::MappedFile file_;
+	ColumnSchema schema_;
+	uint16_t version_ = 0;
+	uint32_t chunkRows_ = 0;
+	uint64_t rows_ = 0;
+	uint64_t calibHash_ = 0;
+	std::vector<uint64_t> blocks_;                       // 各块各列的起始位置，最后一项为数据区结束位置
+	mutable std::vector<std::vector<int32_t>> cache_;   // 编码列的解码缓存
+	mutable std::vector<size_t> cacheChunk_;             // 缓存对应的块号
+
+	// 第 chunk 块第 col 列的起始地址与行数
+	const char* ColumnData(size_t col, size_t chunk, ColumnType type, size_t& rows) const;
+};
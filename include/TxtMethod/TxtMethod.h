@@ -3,21 +3,242 @@
 #include <vector>
 #include <string>
 #include <fstream>
+#include <cstdint>
+#include <cstddef>
+#include <initializer_list>
+#include <functional>
+
+namespace WeldTrackApp {
+	class WorkStealingPool;
+}
+
+/** 列数据类型 */
+enum class ColumnType {
+	Float64,   // double
+	Int32      // int32_t，如插补增量 (mm/0.001, 度/0.0001)
+};
+
+/** 二进制日志（BinLog）中 int32 列的存储编码，见 VarintCodec.h */
+enum class ColumnCodec : uint8_t {
+	Raw,       // 原始数值，可零拷贝访问
+	Delta,     // 一阶差分编码，适用于插补增量等相邻周期几乎不变的量
+	Delta2     // 二阶差分编码，适用于 CartesianPos / PulsePos 等匀速变化的位置
+};
+
+/** 列描述 */
+struct ColumnSpec {
+	std::string name;
+	ColumnType type = ColumnType::Float64;
+	ColumnCodec codec = ColumnCodec::Raw;
+};
+
+/**
+ * 文本日志的列定义：列数、列名与类型
+ */
+class ColumnSchema {
+public:
+	ColumnSchema() = default;
+	ColumnSchema(std::initializer_list<ColumnSpec> cols);
+
+	/** n 个 double 列，列名为 prefix0, prefix1, ... */
+	static ColumnSchema Doubles(size_t n, const std::string& prefix = "c");
+	/** 测量点 [x, y, z]，即 ReadData / WriteTxt 的格式 */
+	static ColumnSchema Point3();
+	/** 位姿 [x, y, z, rx, ry, rz]，即 Cal_WeldPara 的示教轨迹 */
+	static ColumnSchema Pose6();
+	/** 跟踪数据 trackDatas_Save 行：前5列 c0..c4，第 5-7 列为位置 [x, y, z] */
+	static ColumnSchema TrackSave();
+	/** n 个 int32 列，列名为 prefix0, prefix1, ...，如 RobotRecvMsg 的 CartesianPos / PulsePos */
+	static ColumnSchema Int32s(size_t n, const std::string& prefix = "i", ColumnCodec codec = ColumnCodec::Raw);
+	/** 插补增量 [dx, dy, dz, drx, dry, drz]（int32） */
+	static ColumnSchema IncData(ColumnCodec codec = ColumnCodec::Raw);
+
+	/** 追加一列 */
+	void Add(const std::string& name, ColumnType type = ColumnType::Float64, ColumnCodec codec = ColumnCodec::Raw);
+
+	size_t Size() const { return cols_.size(); }
+	const ColumnSpec& operator[](size_t i) const { return cols_[i]; }
+
+	/** 按列名查找列下标，未找到返回 -1 */
+	int IndexOf(const std::string& name) const;
+
+private:
+	std::vector<ColumnSpec> cols_;
+};
+
+/**
+ * 列存储表：每列一段连续数组，按列定义的类型存放
+ */
+class ColumnTable {
+public:
+	ColumnTable() = default;
+	explicit ColumnTable(const ColumnSchema& schema);
+
+	const ColumnSchema& Schema() const { return schema_; }
+	size_t Rows() const { return rows_; }
+	size_t Cols() const { return schema_.Size(); }
+
+	/** 为 rows 行预留空间 */
+	void Reserve(size_t rows);
+	/** 清空数据（列定义不变） */
+	void Clear();
+
+	/**
+	 * 第 col 列的连续数据
+	 * 列类型与访问函数不符或下标越界时抛出异常
+	 */
+	const std::vector<double>& Float64(size_t col) const;
+	const std::vector<int32_t>& Int32(size_t col) const;
+	const std::vector<double>& Float64(const std::string& name) const;
+	const std::vector<int32_t>& Int32(const std::string& name) const;
+
+	/** 第 row 行第 col 列的值（int32 列转换为 double） */
+	double Value(size_t row, size_t col) const;
+
+	/**
+	 * 追加一行
+	 * @param row 各列的值，个数须与列数相同；int32 列按四舍五入取整
+	 */
+	void AppendRow(const std::vector<double>& row);
+
+	/** 追加另一个表的全部行，列定义须一致（列数与类型相同） */
+	void Append(const ColumnTable& other);
+
+	/**
+	 * 转换为行向量形式（与 ReadData 的返回形式相同）
+	 * @return 二维向量，外层 = 行，内层 = 各列的值
+	 */
+	std::vector<std::vector<double>> ToRows() const;
+
+private:
+	friend class TxtMethod;
+	friend class BinLogReader;
+
+	struct Column {
+		std::vector<double> f64;
+		std::vector<int32_t> i32;
+	};
+
+	ColumnSchema schema_;
+	std::vector<Column> cols_;
+	size_t rows_ = 0;
+
+	// 解析一行文本，前 Cols() 个字段均有效时追加，否则跳过
+	bool AppendText(const char* first, const char* last);
+	size_t CheckCol(size_t col, ColumnType type) const;
+};
 
 class TxtMethod {
 public:
 	/**
-	 * ıļȡݣÿа3doubleֵոָ
-	 * @param FileName ļ·
-	 * @return άڲ̶Ϊ3Ԫ [x, y, z]
+	 * 从文本文件读取数据（每行包含3个double值，空格分隔）
+	 * 每行取前3个字段，字段不足或其中任一无法转换的行被跳过；数值与 std::stod 结果一致
+	 * @param FileName 文件路径
+	 * @return 二维向量，内层向量固定为3个元素 [x, y, z]
 	 */
 	std::vector<std::vector<double>> ReadData(const std::string& FileName);
 
 	/**
-	*дıļֵʽΪ"0000.00"
-	* @param ilv_LaserPoints дݣ = Уڲ = У
-	* @param FileName ļ·
+	 * 按列定义读取文本文件到列存储
+	 * 每行取前 schema.Size() 个字段，跳过规则与 ReadData 相同；double 列与 std::stod 结果一致，
+	 * int32 列须为完整的十进制整数
+	 * @param FileName 文件路径
+	 * @param schema 列定义
+	 * @return 列存储表，文件无法打开时为空表
+	 */
+	ColumnTable ReadColumns(const std::string& FileName, const ColumnSchema& schema);
+
+	/** 并行读取时每段的大致字节数 */
+	static constexpr size_t ParallelSegmentBytes = 4 << 20;
+
+	/**
+	 * 并行读取单个文件：文件映射到内存后在行边界处切分为若干段，各段在线程池上并行解析，
+	 * 结果与 ReadData 相同（行序不变）
+	 * @param FileName 文件路径
+	 * @param pool 线程池
+	 * @param segmentBytes 每段的大致字节数
+	 * @return 二维向量，文件无法打开时为空
+	 */
+	std::vector<std::vector<double>> ReadDataParallel(const std::string& FileName,
+		WeldTrackApp::WorkStealingPool& pool, size_t segmentBytes = ParallelSegmentBytes);
+
+	/**
+	 * 并行读取多个文件：所有文件的段统一调度，结果与逐个调用 ReadData 相同
+	 * @return 与 FileNames 同序的读取结果，无法打开的文件对应空结果
+	 */
+	std::vector<std::vector<std::vector<double>>> ReadDataParallel(const std::vector<std::string>& FileNames,
+		WeldTrackApp::WorkStealingPool& pool, size_t segmentBytes = ParallelSegmentBytes);
+
+	/** 并行按列定义读取单个文件，结果与 ReadColumns 相同 */
+	ColumnTable ReadColumnsParallel(const std::string& FileName, const ColumnSchema& schema,
+		WeldTrackApp::WorkStealingPool& pool, size_t segmentBytes = ParallelSegmentBytes);
+
+	/** 并行按列定义读取多个文件，结果与逐个调用 ReadColumns 相同 */
+	std::vector<ColumnTable> ReadColumnsParallel(const std::vector<std::string>& FileNames,
+		const ColumnSchema& schema, WeldTrackApp::WorkStealingPool& pool, size_t segmentBytes = ParallelSegmentBytes);
+
+	/**
+	 * 按块流式读取文本文件，内存占用与文件大小无关
+	 * 解析规则与 ReadColumns 相同；每积累 chunkRows 行调用一次 onChunk，最后一块可不足 chunkRows 行。
+	 * 块的存储在回调之间复用，回调返回后不应再访问
+	 * @param FileName 文件路径
+	 * @param schema 列定义
+	 * @param chunkRows 每块行数，为 0 时抛出 std::invalid_argument
+	 * @param onChunk 块回调，返回 false 时停止读取
+	 * @return 文件无法打开时返回 false
+	 */
+	bool ReadChunks(const std::string& FileName, const ColumnSchema& schema, size_t chunkRows,
+		const std::function<bool(const ColumnTable&)>& onChunk);
+
+	/** 数值格式化允许的最大小数位数 */
+	static constexpr int MaxPrecision = 30;
+
+	/**
+	*将数据写入文本文件（数值格式化为"0000.00"）
+	* @param ilv_LaserPoints 待写入的数据（外层 = 行，内层 = 列）
+	* @param FileName 输出文件路径
+	* @param precision 小数位数，超出 [0, MaxPrecision] 时抛出 std::invalid_argument
 	*/
 	void WriteTxt(const std::vector<std::vector<double>>& ilv_LaserPoints,
-		const std::string& FileName);
-};
\ No newline at end of file
+		const std::string& FileName, int precision = 2);
+
+	/**
+	 * 将一个数值按 WriteTxt 的格式追加到字符串末尾
+	 * 整数部分补零到 4 位（precision = 2 时为 "0000.00"，负数的零补在符号前），不分配临时字符串
+	 * @param out 输出字符串
+	 * @param value 数值
+	 * @param precision 小数位数
+	 */
+	static void AppendDouble(std::string& out, double value, int precision = 2);
+
+	/**
+	 * 将一行数据按 WriteTxt 的格式追加到字符串末尾（含换行符）
+	 * @param out 输出字符串
+	 * @param values 数值
+	 * @param count 数值个数
+	 * @param precision 小数位数
+	 */
+	static void AppendTxtLine(std::string& out, const double* values, size_t count, int precision = 2);
+
+	/**
+	 * 文本日志转换为二进制列式日志（见 BinLog.h）
+	 * @param TxtFileName 文本文件路径
+	 * @param BinFileName 输出的二进制文件路径
+	 * @param schema 列定义
+	 * @param calibHash 标定哈希
+	 * @return 成功返回 true
+	 */
+	bool TxtToBinLog(const std::string& TxtFileName, const std::string& BinFileName,
+		const ColumnSchema& schema, uint64_t calibHash = 0);
+
+	/**
+	 * 二进制列式日志转换为文本日志（double 列格式化为"0000.00"，int32 列为整数）
+	 * @param BinFileName 二进制文件路径
+	 * @param TxtFileName 输出的文本文件路径
+	 * @return 成功返回 true
+	 */
+	bool BinLogToTxt(const std::string& BinFileName, const std::string& TxtFileName);
+
+private:
+	static void CheckPrecision(int precision);
+};
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <vector>
+#include <deque>
+#include <string>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <iterator>
+#include <cstdint>
+#include <cstddef>
+#include "TxtMethod/TxtMethod.h"
+
+/**
+ * 文本日志流式读取
+ * 后台线程按块解析文件（TxtMethod::ReadChunks），最多预读 readAhead 块后等待调用方取走；
+ * 块的存储循环复用，内存占用约为 (readAhead + 2) 块，与文件大小无关。
+ *
+ * 用法一：按块处理
+ *   TxtStreamReader reader("track.txt", ColumnSchema::Point3());
+ *   ColumnTable chunk;
+ *   while (reader.Next(chunk)) { ... }
+ * 用法二：逐行遍历（单趟，与 Next 不可混用）
+ *   for (const std::vector<double>& row : reader) { ... }
+ */
+class TxtStreamReader {
+public:
+	/**
+	 * @param FileName 文件路径，无法打开时抛出 std::runtime_error
+	 * @param schema 列定义，解析规则与 ReadColumns 相同
+	 * @param chunkRows 每块行数
+	 * @param readAhead 预读块数（至少 1）
+	 */
+	explicit TxtStreamReader(const std::string& FileName, const ColumnSchema& schema = ColumnSchema::Point3(),
+		size_t chunkRows = 65536, size_t readAhead = 2);
+
+	/** 未读完时停止后台线程 */
+	~TxtStreamReader();
+
+	TxtStreamReader(const TxtStreamReader&) = delete;
+	TxtStreamReader& operator=(const TxtStreamReader&) = delete;
+
+	/**
+	 * 取下一块数据
+	 * @param chunk [out] 下一块数据；传入的表交还给读取器复用
+	 * @return 已读完时返回 false
+	 */
+	bool Next(ColumnTable& chunk);
+
+	/** 单趟前向迭代器，解引用为当前行各列的值（int32 列转换为 double） */
+	class RowIterator {
+	public:
+		using iterator_category = std::input_iterator_tag;
+		using value_type = std::vector<double>;
+		using difference_type = std::ptrdiff_t;
+		using pointer = const std::vector<double>*;
+		using reference = const std::vector<double>&;
+
+		RowIterator() = default;
+		reference operator*() const { return reader_->row_; }
+		pointer operator->() const { return &reader_->row_; }
+		RowIterator& operator++();
+		bool operator==(const RowIterator& other) const { return reader_ == other.reader_; }
+		bool operator!=(const RowIterator& other) const { return reader_ != other.reader_; }
+
+	private:
+		friend class TxtStreamReader;
+		explicit RowIterator(TxtStreamReader* reader) : reader_(reader) {}
+		TxtStreamReader* reader_ = nullptr;  // 读完后为 nullptr
+	};
+
+	RowIterator begin();
+	RowIterator end() { return RowIterator(); }
+
+	const ColumnSchema& Schema() const { return schema_; }
+	size_t ChunkRows() const { return chunkRows_; }
+
+	/** 已交给调用方的行数 */
+	uint64_t RowsRead() const { return rowsRead_; }
+
+private:
+	ColumnSchema schema_;
+	size_t chunkRows_;
+	size_t readAhead_;
+	uint64_t rowsRead_ = 0;
+
+	std::mutex mutex_;
+	std::condition_variable cv_;
+	std::deque<ColumnTable> ready_;   // 已解析、待取走的块
+	std::vector<ColumnTable> free_;   // 可复用的块
+	bool done_ = false;
+	bool stop_ = false;
+	std::thread worker_;
+
+	// 逐行遍历状态
+	ColumnTable current_;
+	size_t rowIndex_ = 0;
+	std::vector<double> row_;
+
+	bool LoadRow();
+};
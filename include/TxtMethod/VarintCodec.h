@@ -0,0 +1,34 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * int32 序列的差分 + zigzag 变长整数编码
+ *
+ * 残差 r：order = 1 时为相邻值之差，order = 2 时为相邻差分之差（首个值前视为 0）。
+ * 每个记号为一个 LEB128 变长整数 u：
+ *   u 的最低位为 0  单个残差，r 为 (u >> 1) 的 zigzag 解码，|r| < 32 时占 1 字节
+ *   u 的最低位为 1  (u >> 1) 个连续的零残差（游程）
+ * 插补增量与匀速运动的位置在相邻周期间几乎不变，残差多为 0，整段匀速运动只需几个字节。
+ * 每段数据独立编码，可单独解码。
+ */
+namespace VarintCodec {
+
+	/**
+	 * 编码 count 个值并追加到 out 末尾
+	 * @param order 差分阶数（1 或 2），其他值抛出 std::invalid_argument
+	 */
+	void Encode(const int32_t* values, size_t count, int order, std::vector<char>& out);
+
+	/**
+	 * 解码 count 个值
+	 * @param data 编码数据
+	 * @param size 数据字节数（可大于实际编码长度）
+	 * @param order 差分阶数，须与编码时相同
+	 * @param values [out] 解码结果，至少 count 个元素
+	 * @return 读取的字节数；数据不完整或格式错误时抛出 std::runtime_error
+	 */
+	size_t Decode(const char* data, size_t size, int order, int32_t* values, size_t count);
+}
@@ -6,15 +6,18 @@
 namespace WeldTrackApp {
 
 	namespace MacroDefine {
-        constexpr int RobotRecvMsg_CRC_Count = 36;        // ɽṹ RobotRecvMsg Լ
-        constexpr int RobotSendMsg_CRC_Count = 115;       // ɽṹ RobotSendMsg Լ
-        constexpr int IncData_Count = 10;                 // ṹ RobotSendMsg е· IncData 
-        constexpr int Motoman_Queue_MCount = 300;         // Motoman ݶе·ݵֵ
-        constexpr int toolNo = 15;                        // ǰǹϵֵ Motoman ʾȷ
-        constexpr double WeldSpeed = 15.0;                // 趨ٶΪλ mm/s
-        constexpr double InterCycle = 0.01;               // Motoman 岹Ϊ 10ms
-        constexpr int filterDelay = 180;                  // ˲ӳʱ 200
-        constexpr double Cab_Corr_X = 0.00;               // 궨λ mm
+        constexpr int RobotRecvMsg_CRC_Count = 36;        // 由结构体 RobotRecvMsg 约束
+        constexpr int RobotSendMsg_CRC_Count = 115;       // 由结构体 RobotSendMsg 约束
+        constexpr int IncData_Count = 10;                 // 结构体 RobotSendMsg 中单次下发的 IncData 数量
+        constexpr int Motoman_Queue_MCount = 300;         // Motoman 增量数据队列中的允许下发数据的最大值
+        constexpr int toolNo = 15;                        // 当前焊枪坐标系的值，由 Motoman 示教器确定
+        constexpr double WeldSpeed = 15.0;                // 设定焊接速度为单位 mm/s
+        constexpr double InterCycle = 0.01;               // Motoman 插补周期为 10ms
+        constexpr double WeldMaxAcc = 100.0;              // 样条插补最大加速度 mm/s^2
+        constexpr int filterDelay = 180;                  // 卡尔曼滤波器延迟时间 200
+        constexpr double KalmanInitCov = 10.0;            // 卡尔曼滤波器初始过程协方差
+        constexpr double LeadDistance = filterDelay * WeldSpeed * InterCycle;  // 激光线超前焊枪的距离 mm，按设定速度与 filterDelay 换算
+        constexpr double Cab_Corr_X = 0.00;               // 标定误差补偿，单位 mm
         constexpr double Cab_Corr_Y = 0.00;
         constexpr double Cab_Corr_Z = 0.0;
 }
@@ -61,7 +64,7 @@ namespace WeldTrackApp {
         std::array<int32_t, 8> inputIOvalue = {};
 
         int32_t CurQueueCount = 0;
-        int32_t is_CRCOk = 0;              // ʶPC˴CRCǷȷȷΪ1Ϊ0 
+        int32_t is_CRCOk = 0;              // 标识PC端传来的数据CRC是否正确，正确为1，错误为0 
         int32_t CRCData = 0;
     };
 
@@ -71,22 +74,30 @@ namespace WeldTrackApp {
 
     struct IncData {
         std::array<int32_t, 8> incData = {};
-        int32_t toolNo = MacroDefine::toolNo; // ʹóʼ
-        int32_t incDataType = 0;              // 
+        int32_t toolNo = MacroDefine::toolNo; // 使用常量初始化
+        int32_t incDataType = 0;              // 增量数据类型
     };
 
+    // 单个插补周期的增量 [Δx, Δy, Δz, Δrx, Δry, Δrz] (单位: mm/0.001, 度/0.0001)
+    // 内存布局与 IncData::incData 前6个元素一致，可直接整体拷贝进下发报文
+    struct IncPt {
+        int32_t d[6] = {};
+    };
+    static_assert(sizeof(IncPt) == 6 * sizeof(int32_t), "IncPt must be packed");
+    static_assert(sizeof(IncPt) <= sizeof(IncData::incData), "IncPt must fit in IncData");
+
     struct RobotSendMsg {
-        int32_t serialNumber = 0;          // к
+        int32_t serialNumber = 0;          // 序列号
 
         std::array<IncData, MacroDefine::IncData_Count> datalist = {};
-        std::array<int32_t, 8> outputIOvalue = {};   // Ӧ˿IOֵ
-
-        int32_t count = 0;                 // Ǵ˴·ĵ
-        int32_t ifclear = 0;               // 0ʾնУ1ʾ
-        int32_t ifRequestData = 0;         // 0ʾݣ1ʾ
-        int32_t ifStopTcp = 0;             // 0ʾӣ1ʾ˳
-        int32_t ifSetIOvalue = 0;          // 0ʾֵ1ʾֵ 
-        int32_t CRCData = 0;               // CRCУ  
+        std::array<int32_t, 8> outputIOvalue = {};   // 对应端口IO值
+
+        int32_t count = 0;                 // 标记此次下发的点数
+        int32_t ifclear = 0;               // 0表示清空队列，1表示正常入队
+        int32_t ifRequestData = 0;         // 0表示不请求数据，1表示请求数据
+        int32_t ifStopTcp = 0;             // 0表示正常连接，1表示退出连接
+        int32_t ifSetIOvalue = 0;          // 0表示不设置数字量输出值，1表示设置数字量输出值 
+        int32_t CRCData = 0;               // CRC校验码  
 
     };
 
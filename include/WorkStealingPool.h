@@ -0,0 +1,260 @@
+#pragma once
+
+#include <vector>
+#include <deque>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+#include <future>
+#include <exception>
+#include <algorithm>
+#include <type_traits>
+#include <chrono>
+
+namespace WeldTrackApp {
+
+    /// @brief 工作窃取线程池
+    /// 每个工作线程拥有独立的任务双端队列：自身从队尾取任务（LIFO，缓存友好），
+    /// 空闲线程从其他队列的队首窃取任务（FIFO），避免单一全局队列的锁竞争。
+    class WorkStealingPool {
+    public:
+        using Task = std::function<void()>;
+
+        /// @brief 构造线程池
+        /// @param threadNum 工作线程数，0 表示取硬件并发数
+        explicit WorkStealingPool(size_t threadNum = 0)
+        {
+            if (threadNum == 0) {
+                threadNum = std::max<size_t>(1, std::thread::hardware_concurrency());
+            }
+            queues_.reserve(threadNum);
+            for (size_t i = 0; i < threadNum; ++i) {
+                queues_.push_back(std::make_unique<WorkQueue>());
+            }
+            workers_.reserve(threadNum);
+            for (size_t i = 0; i < threadNum; ++i) {
+                workers_.emplace_back(&WorkStealingPool::WorkerLoop, this, i);
+            }
+        }
+
+        ~WorkStealingPool()
+        {
+            {
+                std::lock_guard<std::mutex> lock(wake_mutex_);
+                stop_ = true;
+            }
+            wake_cv_.notify_all();
+            for (auto& worker : workers_) {
+                if (worker.joinable()) {
+                    worker.join();
+                }
+            }
+        }
+
+        // 禁止拷贝和赋值
+        WorkStealingPool(const WorkStealingPool&) = delete;
+        WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+        /// @brief 工作线程数
+        size_t ThreadNum() const { return workers_.size(); }
+
+        /// @brief 当前线程在本线程池中的编号
+        /// @return 工作线程返回 [0, ThreadNum())，外部线程返回 ThreadNum()
+        size_t WorkerIndex() const
+        {
+            return (CurPool() == this) ? CurIndex() : workers_.size();
+        }
+
+        /// @brief 提交任务
+        /// 工作线程内提交的任务进入自身队列，外部线程按轮转方式分发
+        void Push(Task task)
+        {
+            size_t idx = WorkerIndex();
+            if (idx >= queues_.size()) {
+                idx = next_queue_.fetch_add(1, std::memory_order_relaxed) % queues_.size();
+            }
+            // 先计数后入队，保证出队时计数不会下溢
+            pending_.fetch_add(1, std::memory_order_release);
+            {
+                std::lock_guard<std::mutex> lock(queues_[idx]->mutex);
+                queues_[idx]->tasks.push_back(std::move(task));
+            }
+            {
+                // 与 WorkerLoop 的等待条件同步，避免丢失唤醒
+                std::lock_guard<std::mutex> lock(wake_mutex_);
+            }
+            wake_cv_.notify_one();
+        }
+
+        /// @brief 提交带返回值的任务
+        /// @return 与任务结果关联的 future（异常经由 future 传递）
+        template <typename F>
+        auto Submit(F&& func) -> std::future<std::invoke_result_t<std::decay_t<F>>>
+        {
+            using R = std::invoke_result_t<std::decay_t<F>>;
+            auto task = std::make_shared<std::packaged_task<R()>>(std::forward<F>(func));
+            std::future<R> result = task->get_future();
+            Push([task]() { (*task)(); });
+            return result;
+        }
+
+        /// @brief 尝试取出并执行一个任务（供等待中的线程协助执行）
+        /// @return 执行了任务返回 true，否则 false
+        bool RunPendingTask()
+        {
+            Task task;
+            if (!PopTask(WorkerIndex(), task)) {
+                return false;
+            }
+            task();
+            return true;
+        }
+
+        /// @brief 并行执行区间 [begin, end)，按 grain 划分任务块
+        /// 调用线程同样参与执行，所有块完成后返回；首个异常在返回前重新抛出
+        /// @param func 形如 void(size_t chunkBegin, size_t chunkEnd) 的可调用对象
+        template <typename F>
+        void ParallelFor(size_t begin, size_t end, size_t grain, F&& func)
+        {
+            if (begin >= end) {
+                return;
+            }
+            grain = std::max<size_t>(1, grain);
+            const size_t chunkNum = (end - begin + grain - 1) / grain;
+
+            TaskGroup group;
+            group.remain.store(chunkNum, std::memory_order_relaxed);
+            // 第 0 块留给调用线程，其余块入队
+            for (size_t i = 1; i < chunkNum; ++i) {
+                size_t b = begin + i * grain;
+                size_t e = std::min(end, b + grain);
+                Push([&group, &func, b, e]() { group.Run(func, b, e); });
+            }
+            group.Run(func, begin, std::min(end, begin + grain));
+
+            // 协助执行剩余任务，直到本组全部完成
+            while (group.remain.load(std::memory_order_acquire) != 0) {
+                if (!RunPendingTask()) {
+                    std::unique_lock<std::mutex> lock(group.mutex);
+                    group.cv.wait_for(lock, std::chrono::microseconds(200), [&group]() {
+                        return group.remain.load(std::memory_order_acquire) == 0;
+                    });
+                }
+            }
+            std::lock_guard<std::mutex> lock(group.mutex);
+            if (group.error) {
+                std::rethrow_exception(group.error);
+            }
+        }
+
+    private:
+        struct WorkQueue {
+            std::mutex mutex;
+            std::deque<Task> tasks;
+        };
+
+        struct TaskGroup {
+            std::atomic<size_t> remain{ 0 };
+            std::mutex mutex;
+            std::condition_variable cv;
+            std::exception_ptr error;
+
+            template <typename F>
+            void Run(F& func, size_t b, size_t e)
+            {
+                try {
+                    func(b, e);
+                }
+                catch (...) {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (!error) {
+                        error = std::current_exception();
+                    }
+                }
+                // 持锁递减并通知，保证等待方返回（销毁本组）前此处已释放锁
+                std::lock_guard<std::mutex> lock(mutex);
+                if (remain.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                    cv.notify_all();
+                }
+            }
+        };
+
+        static const WorkStealingPool*& CurPool()
+        {
+            static thread_local const WorkStealingPool* pool = nullptr;
+            return pool;
+        }
+
+        static size_t& CurIndex()
+        {
+            static thread_local size_t index = 0;
+            return index;
+        }
+
+        // 先取自身队列队尾，再依次窃取其他队列队首
+        bool PopTask(size_t self, Task& task)
+        {
+            const size_t n = queues_.size();
+            if (self < n) {
+                std::lock_guard<std::mutex> lock(queues_[self]->mutex);
+                if (!queues_[self]->tasks.empty()) {
+                    task = std::move(queues_[self]->tasks.back());
+                    queues_[self]->tasks.pop_back();
+                    pending_.fetch_sub(1, std::memory_order_relaxed);
+                    return true;
+                }
+            }
+            const size_t start = (self < n) ? self + 1 : 0;
+            for (size_t k = 0; k < n; ++k) {
+                size_t victim = (start + k) % n;
+                if (victim == self) {
+                    continue;
+                }
+                std::lock_guard<std::mutex> lock(queues_[victim]->mutex);
+                if (!queues_[victim]->tasks.empty()) {
+                    task = std::move(queues_[victim]->tasks.front());
+                    queues_[victim]->tasks.pop_front();
+                    pending_.fetch_sub(1, std::memory_order_relaxed);
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        void WorkerLoop(size_t index)
+        {
+            CurPool() = this;
+            CurIndex() = index;
+
+            while (true) {
+                Task task;
+                if (PopTask(index, task)) {
+                    task();
+                    continue;
+                }
+                std::unique_lock<std::mutex> lock(wake_mutex_);
+                wake_cv_.wait(lock, [this]() {
+                    return stop_ || pending_.load(std::memory_order_acquire) > 0;
+                });
+                if (stop_ && pending_.load(std::memory_order_acquire) == 0) {
+                    return;
+                }
+            }
+        }
+
+    private:
+        std::vector<std::unique_ptr<WorkQueue>> queues_;
+        std::vector<std::thread> workers_;
+
+        std::atomic<size_t> pending_{ 0 };
+        std::atomic<size_t> next_queue_{ 0 };
+
+        std::mutex wake_mutex_;
+        std::condition_variable wake_cv_;
+        bool stop_ = false;
+    };
+
+} // namespace WeldTrackApp
@@ -0,0 +1,209 @@
+#include "ImageMethod/FrameStore.h"
+#include <filesystem>
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+namespace fs = std::filesystem;
+
+namespace {
+    constexpr size_t HeaderBytes = 48;
+
+    size_t AlignUp(size_t bytes, size_t align) {
+        return (bytes + align - 1) / align * align;
+    }
+
+    template <typename T>
+    void Put(char* buf, size_t offset, T value) {
+        std::memcpy(buf + offset, &value, sizeof(T));
+    }
+
+    template <typename T>
+    T Get(const char* data, size_t offset) {
+        T value;
+        std::memcpy(&value, data + offset, sizeof(T));
+        return value;
+    }
+
+    int64_t FileTimeUs(const fs::file_time_type& time) {
+        return std::chrono::duration_cast<std::chrono::microseconds>(time.time_since_epoch()).count();
+    }
+}
+
+std::vector<std::string> FrameStore::ListFrameFiles(const std::string& dir, const std::string& ext) {
+    // 先取出修改时间再排序，避免比较函数中每次比较都查询文件系统
+    std::vector<std::pair<fs::file_time_type, std::string>> entries;
+    std::error_code ec;
+    for (fs::directory_iterator it(dir, ec), end; !ec && it != end; it.increment(ec)) {
+        if (it->path().extension() != ext) {
+            continue;
+        }
+        std::error_code timeEc;
+        const fs::file_time_type time = it->last_write_time(timeEc);
+        if (!timeEc) {
+            entries.emplace_back(time, it->path().string());
+        }
+    }
+    std::sort(entries.begin(), entries.end());
+
+    std::vector<std::string> files;
+    files.reserve(entries.size());
+    for (auto& entry : entries) {
+        files.push_back(std::move(entry.second));
+    }
+    return files;
+}
+
+size_t FrameStore::Convert(const std::vector<std::string>& files, const std::string& FileName,
+    const FrameDecoder& decode) {
+    std::unique_ptr<FrameStoreWriter> writer;
+    std::vector<uint8_t> pixels;
+    for (const std::string& file : files) {
+        uint32_t width = 0;
+        uint32_t height = 0;
+        pixels.clear();
+        if (!decode(file, pixels, width, height) || width == 0 || height == 0
+            || pixels.size() < static_cast<size_t>(width) * height) {
+            continue;
+        }
+        if (!writer) {
+            writer.reset(new FrameStoreWriter(FileName, width, height));
+        }
+        else if (width != writer->Width() || height != writer->Height()) {
+            continue;
+        }
+        std::error_code ec;
+        const fs::file_time_type time = fs::last_write_time(file, ec);
+        writer->Append(pixels.data(), ec ? 0 : FileTimeUs(time));
+    }
+    if (!writer) {
+        return 0;
+    }
+    writer->Close();
+    return static_cast<size_t>(writer->Frames());
+}
+
+FrameStoreWriter::FrameStoreWriter(const std::string& FileName, uint32_t width, uint32_t height)
+    : width_(width), height_(height) {
+    if (width == 0 || height == 0) {
+        throw std::invalid_argument("frame size must be bigger than 0");
+    }
+    frameBytes_ = AlignUp(static_cast<size_t>(width) * height, FrameStore::FrameAlign);
+    frame_.assign(frameBytes_, 0);
+
+    file_.open(FileName, std::ios::binary | std::ios::trunc);
+    if (!file_.is_open()) {
+        throw std::runtime_error("Error creating file: " + FileName);
+    }
+
+    // 文件头：帧数与索引位置在 Close 时回填
+    std::vector<char> header(FrameStore::DataAlign, 0);
+    std::memcpy(header.data(), FrameStore::Magic, 4);
+    Put<uint16_t>(header.data(), 4, FrameStore::Version);
+    Put<uint32_t>(header.data(), 8, width);
+    Put<uint32_t>(header.data(), 12, height);
+    Put<uint32_t>(header.data(), 16, static_cast<uint32_t>(frameBytes_));
+    Put<uint64_t>(header.data(), 32, FrameStore::DataAlign);
+    file_.write(header.data(), static_cast<std::streamsize>(header.size()));
+}
+
+FrameStoreWriter::~FrameStoreWriter() {
+    try {
+        Close();
+    }
+    catch (...) {
+    }
+}
+
+void FrameStoreWriter::Append(const uint8_t* pixels, int64_t timeUs, size_t srcStride) {
+    if (closed_) {
+        throw std::logic_error("frame store already closed");
+    }
+    if (srcStride == 0) {
+        srcStride = width_;
+    }
+    if (srcStride < width_) {
+        throw std::invalid_argument("source stride must not be smaller than width");
+    }
+
+    if (srcStride == width_) {
+        std::memcpy(frame_.data(), pixels, static_cast<size_t>(width_) * height_);
+    }
+    else {
+        for (uint32_t row = 0; row < height_; ++row) {
+            std::memcpy(frame_.data() + static_cast<size_t>(row) * width_, pixels + row * srcStride, width_);
+        }
+    }
+    file_.write(frame_.data(), static_cast<std::streamsize>(frameBytes_));
+    times_.push_back(timeUs);
+    ++frames_;
+}
+
+void FrameStoreWriter::Close() {
+    if (closed_) {
+        return;
+    }
+    closed_ = true;
+
+    const uint64_t indexOffset = FrameStore::DataAlign + frames_ * frameBytes_;
+    file_.write(reinterpret_cast<const char*>(times_.data()),
+        static_cast<std::streamsize>(times_.size() * sizeof(int64_t)));
+
+    char patch[24];
+    Put<uint64_t>(patch, 0, frames_);
+    Put<uint64_t>(patch, 8, FrameStore::DataAlign);
+    Put<uint64_t>(patch, 16, indexOffset);
+    file_.seekp(24);
+    file_.write(patch, sizeof(patch));
+    file_.close();
+    if (file_.fail()) {
+        throw std::runtime_error("Error writing frame store");
+    }
+}
+
+FrameStoreReader::FrameStoreReader(const std::string& FileName)
+    : file_(FileName) {
+    const char* data = file_.Data();
+    const size_t size = file_.Size();
+    if (size < HeaderBytes || std::memcmp(data, FrameStore::Magic, 4) != 0) {
+        throw std::runtime_error("not a frame store: " + FileName);
+    }
+    if (Get<uint16_t>(data, 4) != FrameStore::Version) {
+        throw std::runtime_error("unsupported frame store version: " + FileName);
+    }
+
+    width_ = Get<uint32_t>(data, 8);
+    height_ = Get<uint32_t>(data, 12);
+    frameBytes_ = Get<uint32_t>(data, 16);
+    const uint64_t frames = Get<uint64_t>(data, 24);
+    const uint64_t dataOffset = Get<uint64_t>(data, 32);
+    const uint64_t indexOffset = Get<uint64_t>(data, 40);
+
+    // 未正常关闭的文件索引位置为 0，同样视为格式错误
+    const bool sizeOk = width_ > 0 && height_ > 0 && frameBytes_ >= static_cast<size_t>(width_) * height_;
+    const bool layoutOk = sizeOk && dataOffset >= HeaderBytes && dataOffset <= size
+        && frames <= (size - dataOffset) / frameBytes_
+        && indexOffset == dataOffset + frames * frameBytes_ && indexOffset + frames * sizeof(int64_t) <= size;
+    if (!layoutOk) {
+        throw std::runtime_error("corrupt frame store: " + FileName);
+    }
+
+    frames_ = static_cast<size_t>(frames);
+    data_ = data + dataOffset;
+    index_ = data + indexOffset;
+}
+
+FrameView FrameStoreReader::Frame(size_t i) const {
+    if (i >= frames_) {
+        throw std::out_of_range("frame index out of range");
+    }
+    FrameView view;
+    view.data = reinterpret_cast<const uint8_t*>(data_ + i * frameBytes_);
+    view.width = width_;
+    view.height = height_;
+    view.timeUs = Get<int64_t>(index_, i * sizeof(int64_t));
+    return view;
+}
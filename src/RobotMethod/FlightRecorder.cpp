@@ -0,0 +1,246 @@
+#include "RobotMethod/FlightRecorder.h"
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+namespace WeldTrackApp {
+
+    namespace {
+        const char* EventName(FlightEvent event)
+        {
+            switch (event) {
+            case FlightEvent::Stripe: return "Stripe";
+            case FlightEvent::RobotStatus: return "Robot";
+            case FlightEvent::FilteredPoint: return "Point";
+            case FlightEvent::SentInc: return "Inc";
+            case FlightEvent::Status: return "Status";
+            case FlightEvent::Fault: return "Fault";
+            default: return "Mark";
+            }
+        }
+
+        // 辅助函数：数值按最短往返格式追加
+        template <typename T>
+        void AppendNumber(std::string& out, T value)
+        {
+            char buf[32];
+            const std::to_chars_result res = std::to_chars(buf, buf + sizeof(buf), value);
+            out.append(buf, res.ptr);
+        }
+    }
+
+    FlightRecorder::FlightRecorder(size_t capacity, const std::string& dumpDir)
+        : start_(std::chrono::steady_clock::now()), dumpDir_(dumpDir)
+    {
+        if (capacity < 2) {
+            throw std::invalid_argument("flight recorder capacity must be at least 2");
+        }
+        size_t size = 2;
+        while (size < capacity) {
+            size <<= 1;
+        }
+        mask_ = size - 1;
+        slots_.reset(new Slot[size]);
+        if (!dumpDir_.empty()) {
+            worker_ = std::thread(&FlightRecorder::WorkerLoop, this);
+        }
+    }
+
+    FlightRecorder::~FlightRecorder()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        cv_.notify_all();
+        if (worker_.joinable()) {
+            worker_.join();
+        }
+    }
+
+    FlightRecorder::Slot& FlightRecorder::BeginRecord(FlightEvent event, int32_t code, size_t count, uint64_t& pos)
+    {
+        const int64_t timeUs = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start_).count();
+        pos = head_.fetch_add(1, std::memory_order_relaxed);
+        Slot& slot = slots_[pos & mask_];
+
+        slot.seq.store(2 * pos + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        FlightRecord& rec = slot.rec;
+        rec.timeUs = timeUs;
+        rec.code = code;
+        rec.event = event;
+        rec.count = static_cast<uint8_t>(count);
+        return slot;
+    }
+
+    void FlightRecorder::Record(FlightEvent event, int32_t code, const double* values, size_t count)
+    {
+        if (count == 0) {
+            RecordEvent(event, code);
+            return;
+        }
+        count = std::min(count, FlightRecord::MaxValues);
+        uint64_t pos;
+        Slot& slot = BeginRecord(event, code, count, pos);
+        std::memcpy(slot.rec.values, values, count * sizeof(double));
+        slot.seq.store(2 * pos + 2, std::memory_order_release);
+    }
+
+    void FlightRecorder::RecordEvent(FlightEvent event, int32_t code)
+    {
+        uint64_t pos;
+        Slot& slot = BeginRecord(event, code, 0, pos);
+        slot.seq.store(2 * pos + 2, std::memory_order_release);
+    }
+
+    void FlightRecorder::RecordStripe(int32_t frameNo, double r, double c, bool valid)
+    {
+        const double values[3] = { r, c, valid ? 1.0 : 0.0 };
+        Record(FlightEvent::Stripe, frameNo, values, 3);
+    }
+
+    void FlightRecorder::RecordPoint(int32_t frameNo, const double* xyz)
+    {
+        Record(FlightEvent::FilteredPoint, frameNo, xyz, 3);
+    }
+
+    void FlightRecorder::RecordIncs(int32_t serialNumber, const IncPt* incs, size_t incNum)
+    {
+        for (size_t i = 0; i < incNum; ++i) {
+            double values[6];
+            for (int j = 0; j < 6; ++j) {
+                values[j] = incs[i].d[j];
+            }
+            Record(FlightEvent::SentInc, serialNumber, values, 6);
+        }
+    }
+
+    void FlightRecorder::RecordStatus(TrackStatus status)
+    {
+        RecordEvent(FlightEvent::Status, static_cast<int32_t>(status));
+    }
+
+    void FlightRecorder::Trigger(FlightFault fault, const std::string& reason)
+    {
+        RecordEvent(FlightEvent::Fault, static_cast<int32_t>(fault));
+        if (dumpDir_.empty()) {
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (pending_) {
+                return;  // 上一次转储尚未完成
+            }
+            pending_ = true;
+            pendingFault_ = fault;
+            pendingReason_ = reason;
+        }
+        cv_.notify_all();
+    }
+
+    std::vector<FlightRecord> FlightRecorder::Snapshot() const
+    {
+        const uint64_t end = head_.load(std::memory_order_acquire);
+        const uint64_t begin = (end > mask_ + 1) ? end - (mask_ + 1) : 0;
+        std::vector<FlightRecord> records;
+        records.reserve(static_cast<size_t>(end - begin));
+        for (uint64_t pos = begin; pos < end; ++pos) {
+            const Slot& slot = slots_[pos & mask_];
+            const uint64_t seq = slot.seq.load(std::memory_order_acquire);
+            if (seq != 2 * pos + 2) {
+                continue;  // 正在写入或已被更新的记录覆盖
+            }
+            FlightRecord rec = slot.rec;
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot.seq.load(std::memory_order_relaxed) != seq) {
+                continue;  // 拷贝期间被改写
+            }
+            records.push_back(rec);
+        }
+        return records;
+    }
+
+    size_t FlightRecorder::Dump(const std::string& FileName, const std::string& reason) const
+    {
+        const std::vector<FlightRecord> records = Snapshot();
+        std::ofstream file(FileName, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) {
+            throw std::runtime_error("Error creating file: " + FileName);
+        }
+
+        std::string out = "# flight recorder dump: " + reason + "\n# time_us event code values\n";
+        for (const FlightRecord& rec : records) {
+            AppendNumber(out, rec.timeUs);
+            out += ' ';
+            out += EventName(rec.event);
+            out += ' ';
+            AppendNumber(out, rec.code);
+            for (uint8_t i = 0; i < rec.count; ++i) {
+                out += ' ';
+                AppendNumber(out, rec.values[i]);
+            }
+            out += '\n';
+        }
+        file.write(out.data(), static_cast<std::streamsize>(out.size()));
+        if (!file) {
+            throw std::runtime_error("Error writing file: " + FileName);
+        }
+        return records.size();
+    }
+
+    bool FlightRecorder::WaitDump(std::chrono::milliseconds timeout) const
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return cv_.wait_for(lock, timeout, [this]() { return !pending_; });
+    }
+
+    size_t FlightRecorder::DumpCount() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return dumpCount_;
+    }
+
+    std::string FlightRecorder::LastDumpFile() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return lastDumpFile_;
+    }
+
+    void FlightRecorder::WorkerLoop()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (true) {
+            cv_.wait(lock, [this]() { return stop_ || pending_; });
+            if (!pending_) {
+                break;  // 退出前完成已请求的转储
+            }
+            const int64_t timeUs = std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - start_).count();
+            const std::string fileName = dumpDir_ + "/flight_" + std::to_string(dumpCount_) + "_"
+                + std::to_string(static_cast<int32_t>(pendingFault_)) + "_" + std::to_string(timeUs) + ".txt";
+            const std::string reason = pendingReason_;
+            lock.unlock();
+
+            bool ok = true;
+            try {
+                Dump(fileName, reason);
+            }
+            catch (const std::exception&) {
+                ok = false;  // 转储失败不影响记录
+            }
+
+            lock.lock();
+            if (ok) {
+                ++dumpCount_;
+                lastDumpFile_ = fileName;
+            }
+            pending_ = false;
+            cv_.notify_all();
+        }
+    }
+
+} // namespace WeldTrackApp
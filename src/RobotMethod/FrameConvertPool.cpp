@@ -0,0 +1,112 @@
+#include "RobotMethod/FrameConvertPool.h"
+#include "RobotMethod/LaserCoordToTcp.h"
+#include <stdexcept>
+#include <algorithm>
+
+namespace WeldTrackApp {
+
+    FrameConvertPool::FrameConvertPool(size_t threadNum, size_t grain)
+        : grain_(std::max<size_t>(1, grain)),
+          pool_(threadNum)
+    {
+        // 工作线程各一个，外部调用线程一个
+        converters_.reserve(pool_.ThreadNum() + 1);
+        for (size_t i = 0; i <= pool_.ThreadNum(); ++i) {
+            converters_.push_back(std::make_unique<LaserCoordToTcp>());
+        }
+    }
+
+    FrameConvertPool::~FrameConvertPool()
+    {
+        // 等待流水线中的任务结束，避免任务访问已销毁的转换器
+        for (auto& frame : pending_frames_) {
+            if (frame.valid()) {
+                frame.wait();
+            }
+        }
+    }
+
+    std::vector<std::vector<std::vector<double>>> FrameConvertPool::ConvertFrames(
+        const std::vector<StripeFrame>& frames)
+    {
+        std::vector<std::vector<std::vector<double>>> results(frames.size());
+
+        // 展开为 (帧, 点块) 任务，使少量大帧也能占满所有核
+        struct Chunk {
+            size_t frame;
+            size_t begin;
+            size_t end;
+        };
+        std::vector<Chunk> chunks;
+        for (size_t i = 0; i < frames.size(); ++i) {
+            const size_t n = frames[i].pixelPts.size();
+            results[i].resize(n);
+            for (size_t b = 0; b < n; b += grain_) {
+                chunks.push_back({ i, b, std::min(n, b + grain_) });
+            }
+        }
+
+        pool_.ParallelFor(0, chunks.size(), 1, [&](size_t b, size_t e) {
+            for (size_t k = b; k < e; ++k) {
+                const Chunk& chunk = chunks[k];
+                ConvertRange(frames[chunk.frame], chunk.begin, chunk.end, results[chunk.frame]);
+            }
+        });
+
+        return results;
+    }
+
+    void FrameConvertPool::SubmitFrame(StripeFrame frame)
+    {
+        auto shared = std::make_shared<StripeFrame>(std::move(frame));
+        pending_frames_.push_back(pool_.Submit([this, shared]() {
+            std::vector<std::vector<double>> out(shared->pixelPts.size());
+            // 帧内分块，空闲工作线程可窃取
+            pool_.ParallelFor(0, shared->pixelPts.size(), grain_, [&](size_t b, size_t e) {
+                ConvertRange(*shared, b, e, out);
+            });
+            return out;
+        }));
+    }
+
+    bool FrameConvertPool::PopFrame(std::vector<std::vector<double>>& result, bool wait)
+    {
+        if (pending_frames_.empty()) {
+            return false;
+        }
+
+        auto& front = pending_frames_.front();
+        if (!wait) {
+            if (front.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+                return false;
+            }
+        }
+        else {
+            // 调用线程协助执行，避免单核时空等
+            while (front.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+                if (!pool_.RunPendingTask()) {
+                    front.wait_for(std::chrono::microseconds(200));
+                }
+            }
+        }
+
+        auto frame = std::move(front);
+        pending_frames_.pop_front();
+        result = frame.get();  // 转换异常在此处重新抛出
+        return true;
+    }
+
+    void FrameConvertPool::ConvertRange(const StripeFrame& frame, size_t begin, size_t end,
+        std::vector<std::vector<double>>& out)
+    {
+        LaserCoordToTcp& converter = *converters_[pool_.WorkerIndex()];
+        for (size_t i = begin; i < end; ++i) {
+            const auto& pt = frame.pixelPts[i];
+            if (pt.size() < 2) {
+                throw std::invalid_argument("pixel point must contain [r, c]");
+            }
+            out[i] = converter.Cal_LaserMeaPtToBase(pt[0], pt[1], frame.FLPPoint);
+        }
+    }
+
+} // namespace WeldTrackApp
@@ -0,0 +1,94 @@
+#include "RobotMethod/HampelFilter.h"
+#include <cmath>
+#include <algorithm>
+#include <stdexcept>
+
+namespace WeldTrackApp {
+
+    namespace {
+        constexpr double MadScale = 1.4826;  // 正态分布下 MAD 到标准差的换算系数
+    }
+
+    HampelFilter::HampelFilter(size_t window, double nSigma, double minSigma)
+        : window_(window), nSigma_(nSigma), minSigma_(minSigma),
+          axes_{ SortedWindow<>(window), SortedWindow<>(window), SortedWindow<>(window) }
+    {
+        if (window < 3) {
+            throw std::invalid_argument("Hampel window must be at least 3");
+        }
+        if (nSigma <= 0 || minSigma < 0) {
+            throw std::invalid_argument("Hampel threshold must be positive");
+        }
+    }
+
+    std::vector<double> HampelFilter::Update(const std::vector<double>& pt)
+    {
+        if (pt.size() < 3) {
+            throw std::invalid_argument("input point must be 3 - dimensional");
+        }
+
+        for (int i = 0; i < 3; ++i) {
+            if (!std::isfinite(pt[i]) && axes_[i].Size() == 0) {
+                throw std::invalid_argument("non-finite measurement with empty Hampel window");
+            }
+        }
+
+        std::vector<double> out(pt);
+        lastRejected_ = false;
+        lastScore_ = 0.0;
+        ++stats_.samples;
+
+        for (int i = 0; i < 3; ++i) {
+            SortedWindow<>& axis = axes_[i];
+            // 非有限值（丢帧、除零）无法计算偏差：一律判为离群，用中位数替换且不进入窗口
+            if (!std::isfinite(pt[i])) {
+                out[i] = axis.Median();
+                lastScore_ = HUGE_VAL;
+                lastRejected_ = true;
+                ++stats_.axisRejected[i];
+                continue;
+            }
+            // 窗口不足一半时无法给出可靠的中位数，原样输出
+            if (axis.Size() > window_ / 2) {
+                const double median = axis.Median();
+                const double sigma = std::max(MadScale * axis.MedianAbsDev(median), minSigma_);
+                const double score = std::fabs(pt[i] - median) / sigma;
+                lastScore_ = std::max(lastScore_, score);
+                if (score > nSigma_) {
+                    out[i] = median;
+                    lastRejected_ = true;
+                    ++stats_.axisRejected[i];
+                }
+            }
+            // 窗口保存原始测量值，真实的焊缝突变在半个窗口后被接受
+            axis.Push(pt[i]);
+        }
+
+        if (lastRejected_) {
+            ++stats_.rejected;
+        }
+        return out;
+    }
+
+    double HampelFilter::Median(int axis) const
+    {
+        if (axis < 0 || axis > 2) {
+            throw std::out_of_range("axis out of range");
+        }
+        if (axes_[axis].Size() == 0) {
+            throw std::out_of_range("HampelFilter window is empty");
+        }
+        return axes_[axis].Median();
+    }
+
+    void HampelFilter::Reset()
+    {
+        for (auto& axis : axes_) {
+            axis.Clear();
+        }
+        lastRejected_ = false;
+        lastScore_ = 0.0;
+        stats_ = Stats();
+    }
+
+} // namespace WeldTrackApp
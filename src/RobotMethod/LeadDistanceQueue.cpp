@@ -0,0 +1,146 @@
+#include "RobotMethod/LeadDistanceQueue.h"
+#include <cmath>
+#include <stdexcept>
+
+namespace WeldTrackApp {
+
+    namespace {
+        double Distance(const LeadDistanceQueue::Point3d& a, const LeadDistanceQueue::Point3d& b)
+        {
+            const double dx = a[0] - b[0];
+            const double dy = a[1] - b[1];
+            const double dz = a[2] - b[2];
+            return std::sqrt(dx * dx + dy * dy + dz * dz);
+        }
+    }
+
+    LeadDistanceQueue::LeadDistanceQueue(double leadDistance, double minSpacing)
+        : lead_(leadDistance), minSpacing_(minSpacing)
+    {
+        if (leadDistance < 0) {
+            throw std::invalid_argument("LeadDistance must not be negative");
+        }
+        if (minSpacing < 0) {
+            throw std::invalid_argument("MinSpacing must not be negative");
+        }
+    }
+
+    void LeadDistanceQueue::Reset()
+    {
+        queue_.Clear();
+        hasReleased_ = false;
+        seamLen_ = 0.0;
+        hasSeamPt_ = false;
+        torchDist_ = 0.0;
+        hasTorchPos_ = false;
+    }
+
+    bool LeadDistanceQueue::Push(const std::vector<double>& seamPt)
+    {
+        if (seamPt.size() < 3) {
+            throw std::invalid_argument("input point must be 3 - dimensional");
+        }
+        if (queue_.Full()) {
+            return false;
+        }
+
+        Point3d pt = { seamPt[0], seamPt[1], seamPt[2] };
+        if (hasSeamPt_) {
+            const double step = Distance(lastSeamPt_, pt);
+            if (step < minSpacing_) {
+                return true;  // 焊缝点未移动（停顿或测量抖动）
+            }
+            seamLen_ += step;
+        }
+        lastSeamPt_ = pt;
+        hasSeamPt_ = true;
+        queue_.Push({ pt, seamLen_ });
+        return true;
+    }
+
+    void LeadDistanceQueue::UpdateTorch(const std::vector<double>& torchPos)
+    {
+        if (torchPos.size() < 3) {
+            throw std::invalid_argument("input point must be 3 - dimensional");
+        }
+        Point3d pos = { torchPos[0], torchPos[1], torchPos[2] };
+        if (hasTorchPos_) {
+            const double step = Distance(lastTorchPos_, pos);
+            if (step < minSpacing_) {
+                return;
+            }
+            torchDist_ += step;
+        }
+        lastTorchPos_ = pos;
+        hasTorchPos_ = true;
+    }
+
+    void LeadDistanceQueue::SetTorchDistance(double dist)
+    {
+        if (dist > torchDist_) {
+            torchDist_ = dist;
+        }
+    }
+
+    bool LeadDistanceQueue::PopReached(Point3d& seamPt)
+    {
+        // 焊枪路程 = 焊缝弧长 + 超前距离 时到达该点
+        if (queue_.Empty() || queue_.Front().s + lead_ > torchDist_) {
+            return false;
+        }
+        lastReleased_ = queue_.Front();
+        hasReleased_ = true;
+        queue_.PopFront();
+        seamPt = lastReleased_.pt;
+        return true;
+    }
+
+    bool LeadDistanceQueue::CurrentTarget(Point3d& seamPt) const
+    {
+        return SeamPointAt(torchDist_ - lead_, seamPt);
+    }
+
+    bool LeadDistanceQueue::SeamPointAt(double s, Point3d& seamPt) const
+    {
+        // 已释放的最后一个点与队列中的点构成按弧长递增的序列
+        const size_t offset = hasReleased_ ? 1 : 0;
+        const size_t count = queue_.Size() + offset;
+        if (count == 0) {
+            return false;
+        }
+        auto at = [&](size_t i) -> const Entry& {
+            return (i < offset) ? lastReleased_ : queue_[i - offset];
+        };
+
+        if (s <= at(0).s) {
+            seamPt = at(0).pt;
+            return true;
+        }
+        if (s >= at(count - 1).s) {
+            seamPt = at(count - 1).pt;
+            return true;
+        }
+
+        // 二分查找第一个弧长大于 s 的点
+        size_t lo = 1;
+        size_t hi = count - 1;
+        while (lo < hi) {
+            size_t mid = (lo + hi) / 2;
+            if (at(mid).s > s) {
+                hi = mid;
+            }
+            else {
+                lo = mid + 1;
+            }
+        }
+        const Entry& a = at(lo - 1);
+        const Entry& b = at(lo);
+        const double span = b.s - a.s;
+        const double t = (span > 0.0) ? (s - a.s) / span : 0.0;
+        for (int i = 0; i < 3; ++i) {
+            seamPt[i] = a.pt[i] + (b.pt[i] - a.pt[i]) * t;
+        }
+        return true;
+    }
+
+} // namespace WeldTrackApp
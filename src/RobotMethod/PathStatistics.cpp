@@ -0,0 +1,152 @@
+#include "RobotMethod/PathStatistics.h"
+#include "RobotMethod/TrackAlgMethod.h"
+#include <cmath>
+#include <algorithm>
+#include <stdexcept>
+
+namespace WeldTrackApp {
+
+    namespace {
+        // 分段长度内核：各分量连续存放且互不重叠，循环可向量化
+        void SegmentLengths(const double* __restrict x, const double* __restrict y,
+            const double* __restrict z, double* __restrict out, size_t n)
+        {
+            for (size_t i = 0; i < n; ++i) {
+                const double dx = x[i + 1] - x[i];
+                const double dy = y[i + 1] - y[i];
+                const double dz = z[i + 1] - z[i];
+                out[i] = std::sqrt(dx * dx + dy * dy + dz * dz);
+            }
+        }
+
+        void AddOffset(double* __restrict data, double offset, size_t n)
+        {
+            for (size_t i = 0; i < n; ++i) {
+                data[i] += offset;
+            }
+        }
+
+        template <typename F>
+        void RunChunks(WorkStealingPool* pool, size_t n, size_t grain, F&& func)
+        {
+            if (pool != nullptr && n > grain) {
+                pool->ParallelFor(0, n, grain, [&func, grain](size_t b, size_t e) {
+                    func(b / grain, b, e);
+                });
+                return;
+            }
+            for (size_t b = 0; b < n; b += grain) {
+                func(b / grain, b, std::min(n, b + grain));
+            }
+        }
+    }
+
+    TrackPathSoA TrackPathSoA::FromRows(const std::vector<std::vector<double>>& rows,
+        size_t posOffset, bool withAtt, WorkStealingPool* pool)
+    {
+        const size_t minSize = posOffset + (withAtt ? 6 : 3);
+        for (const auto& row : rows) {
+            if (row.size() < minSize) {
+                throw std::invalid_argument("track rows contain invalid datas");
+            }
+        }
+
+        TrackPathSoA path;
+        const size_t n = rows.size();
+        path.x.resize(n);
+        path.y.resize(n);
+        path.z.resize(n);
+        if (withAtt) {
+            path.rx.resize(n);
+            path.ry.resize(n);
+            path.rz.resize(n);
+        }
+
+        RunChunks(pool, n, PathStatistics::DefaultGrain, [&](size_t, size_t b, size_t e) {
+            for (size_t i = b; i < e; ++i) {
+                const double* row = rows[i].data() + posOffset;
+                path.x[i] = row[0];
+                path.y[i] = row[1];
+                path.z[i] = row[2];
+                if (withAtt) {
+                    path.rx[i] = row[3];
+                    path.ry[i] = row[4];
+                    path.rz[i] = row[5];
+                }
+            }
+        });
+        return path;
+    }
+
+    PathStatistics::PathStatistics(WorkStealingPool* pool, size_t grain)
+        : pool_(pool), grain_(std::max<size_t>(1, grain))
+    {
+    }
+
+    template <typename F>
+    void PathStatistics::ForEachChunk(size_t n, F&& func) const
+    {
+        RunChunks(pool_, n, grain_, std::forward<F>(func));
+    }
+
+    bool PathStatistics::Calculate(const TrackPathSoA& path, PathStats& stats) const
+    {
+        const size_t n = path.Size();
+        if (path.y.size() != n || path.z.size() != n) {
+            throw std::invalid_argument("track path components size mismatch");
+        }
+
+        stats.totalLen = 0.0;
+        stats.incAtt.assign(3, 0.0);
+        stats.segLen.clear();
+        stats.cumLen.assign(n, 0.0);
+        if (n < 2) {
+            return false;
+        }
+
+        // 姿态增量只与首末点有关
+        const bool hasAtt = path.rx.size() == n && path.ry.size() == n && path.rz.size() == n;
+        if (hasAtt) {
+            TrackAlgMethod alg;
+            stats.incAtt[0] = alg.Cal_IncAtt(path.rx.front(), path.rx.back());
+            stats.incAtt[1] = alg.Cal_IncAtt(path.ry.front(), path.ry.back());
+            stats.incAtt[2] = alg.Cal_IncAtt(path.rz.front(), path.rz.back());
+        }
+
+        // 1. 各块计算分段长度与块内前缀和
+        const size_t segNum = n - 1;
+        const size_t chunkNum = (segNum + grain_ - 1) / grain_;
+        std::vector<double> chunkSum(chunkNum, 0.0);
+        stats.segLen.resize(segNum);
+
+        double* seg = stats.segLen.data();
+        double* cum = stats.cumLen.data();
+        ForEachChunk(segNum, [&](size_t c, size_t b, size_t e) {
+            SegmentLengths(path.x.data() + b, path.y.data() + b, path.z.data() + b, seg + b, e - b);
+            double sum = 0.0;
+            for (size_t i = b; i < e; ++i) {
+                sum += seg[i];
+                cum[i + 1] = sum;
+            }
+            chunkSum[c] = sum;
+        });
+
+        // 2. 块偏移
+        std::vector<double> chunkOffset(chunkNum, 0.0);
+        for (size_t c = 1; c < chunkNum; ++c) {
+            chunkOffset[c] = chunkOffset[c - 1] + chunkSum[c - 1];
+        }
+        stats.totalLen = chunkOffset.back() + chunkSum.back();
+
+        // 3. 修正累计长度
+        if (chunkNum > 1) {
+            ForEachChunk(segNum, [&](size_t c, size_t b, size_t e) {
+                if (c > 0) {
+                    AddOffset(cum + b + 1, chunkOffset[c], e - b);
+                }
+            });
+        }
+        return true;
+    }
+
+} // namespace WeldTrackApp
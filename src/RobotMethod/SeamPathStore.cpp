@@ -0,0 +1,213 @@
+#include "RobotMethod/SeamPathStore.h"
+#include <cmath>
+#include <algorithm>
+#include <stdexcept>
+
+namespace WeldTrackApp {
+
+    namespace {
+        double SquaredDistance(const SeamPathStore::Point3d& a, const SeamPathStore::Point3d& b)
+        {
+            const double dx = a[0] - b[0];
+            const double dy = a[1] - b[1];
+            const double dz = a[2] - b[2];
+            return dx * dx + dy * dy + dz * dz;
+        }
+    }
+
+    SeamPathStore::SeamPathStore(size_t posOffset)
+        : posOffset_(posOffset)
+    {
+    }
+
+    void SeamPathStore::Append(const std::vector<double>& row)
+    {
+        if (row.size() < posOffset_ + 3) {
+            throw std::invalid_argument("seam path row contains invalid datas");
+        }
+        AppendPoint({ row[posOffset_], row[posOffset_ + 1], row[posOffset_ + 2] });
+    }
+
+    void SeamPathStore::AppendPoint(const Point3d& pt)
+    {
+        double len = 0.0;
+        if (!cumLen_.empty()) {
+            len = cumLen_.back() + std::sqrt(SquaredDistance(pts_.back(), pt));
+        }
+        pts_.push_back(pt);
+        cumLen_.push_back(len);
+
+        const long long ix = static_cast<long long>(std::floor(pt[0] / GridCell));
+        const long long iy = static_cast<long long>(std::floor(pt[1] / GridCell));
+        const long long iz = static_cast<long long>(std::floor(pt[2] / GridCell));
+        grid_[CellKey(ix, iy, iz)].push_back(base_ + pts_.size() - 1);
+    }
+
+    void SeamPathStore::Clear()
+    {
+        pts_.clear();
+        cumLen_.clear();
+        head_ = 0;
+        lastNearest_ = 0;
+        grid_.clear();
+        base_ = 0;
+    }
+
+    long long SeamPathStore::CellKey(long long ix, long long iy, long long iz)
+    {
+        // 每轴 21 位；相距 2^21 个单元的网格共用键时只多出候选点，不影响结果
+        const long long mask = (1LL << 21) - 1;
+        return ((ix & mask) << 42) | ((iy & mask) << 21) | (iz & mask);
+    }
+
+    const SeamPathStore::Point3d& SeamPathStore::operator[](size_t i) const
+    {
+        if (i >= Size()) {
+            throw std::out_of_range("SeamPathStore index out of range");
+        }
+        return pts_[head_ + i];
+    }
+
+    double SeamPathStore::ArcLength(size_t i) const
+    {
+        if (i >= Size()) {
+            throw std::out_of_range("SeamPathStore index out of range");
+        }
+        return cumLen_[head_ + i];
+    }
+
+    SeamPathStore::Point3d SeamPathStore::PointAt(double s) const
+    {
+        if (Empty()) {
+            throw std::out_of_range("SeamPathStore is empty");
+        }
+        const auto first = cumLen_.begin() + head_;
+        if (s <= *first) {
+            return pts_[head_];
+        }
+        if (s >= cumLen_.back()) {
+            return pts_.back();
+        }
+
+        // 第一个弧长大于 s 的点，与其前一个点之间插值
+        const size_t k = static_cast<size_t>(std::upper_bound(first, cumLen_.end(), s) - cumLen_.begin());
+        const double span = cumLen_[k] - cumLen_[k - 1];
+        const double t = (span > 0.0) ? (s - cumLen_[k - 1]) / span : 0.0;
+        Point3d pt;
+        for (int i = 0; i < 3; ++i) {
+            pt[i] = pts_[k - 1][i] + (pts_[k][i] - pts_[k - 1][i]) * t;
+        }
+        return pt;
+    }
+
+    size_t SeamPathStore::NearestIndex(const Point3d& pos)
+    {
+        lastNearest_ = NearestIndex(pos, std::min(lastNearest_, Size() == 0 ? 0 : Size() - 1));
+        return lastNearest_;
+    }
+
+    size_t SeamPathStore::NearestIndex(const Point3d& pos, size_t hint) const
+    {
+        if (Empty()) {
+            throw std::out_of_range("SeamPathStore is empty");
+        }
+        size_t idx = std::min(hint, Size() - 1) + head_;
+        double best = SquaredDistance(pts_[idx], pos);
+
+        // 向前
+        while (idx + 1 < pts_.size()) {
+            const double d = SquaredDistance(pts_[idx + 1], pos);
+            if (d > best) {
+                break;
+            }
+            best = d;
+            ++idx;
+        }
+        // 向后
+        while (idx > head_) {
+            const double d = SquaredDistance(pts_[idx - 1], pos);
+            if (d >= best) {
+                break;
+            }
+            best = d;
+            --idx;
+        }
+
+        // 局部极小值不一定是全局最近点：检查以其距离为半径的球所覆盖的网格
+        const double radius = std::sqrt(best);
+        long long lo[3], hi[3];
+        double cellNum = 1.0;
+        for (int i = 0; i < 3; ++i) {
+            lo[i] = static_cast<long long>(std::floor((pos[i] - radius) / GridCell));
+            hi[i] = static_cast<long long>(std::floor((pos[i] + radius) / GridCell));
+            cellNum *= static_cast<double>(hi[i] - lo[i] + 1);
+        }
+        const auto consider = [&](size_t k) {
+            const double d = SquaredDistance(pts_[k], pos);
+            if (d < best) {
+                best = d;
+                idx = k;
+            }
+        };
+        if (cellNum > static_cast<double>(Size())) {
+            for (size_t k = head_; k < pts_.size(); ++k) {
+                consider(k);
+            }
+            return idx - head_;
+        }
+        for (long long ix = lo[0]; ix <= hi[0]; ++ix) {
+            for (long long iy = lo[1]; iy <= hi[1]; ++iy) {
+                for (long long iz = lo[2]; iz <= hi[2]; ++iz) {
+                    const auto it = grid_.find(CellKey(ix, iy, iz));
+                    if (it == grid_.end()) {
+                        continue;
+                    }
+                    for (size_t g : it->second) {
+                        if (g >= base_ + head_) {
+                            consider(g - base_);
+                        }
+                    }
+                }
+            }
+        }
+        return idx - head_;
+    }
+
+    size_t SeamPathStore::TrimBefore(double s)
+    {
+        if (Size() < 2) {
+            return 0;
+        }
+        // 保留最后一个弧长 <= s 的点
+        const auto first = cumLen_.begin() + head_;
+        size_t k = static_cast<size_t>(std::upper_bound(first, cumLen_.end(), s) - cumLen_.begin());
+        if (k <= head_ + 1) {
+            return 0;
+        }
+        const size_t trimmed = k - 1 - head_;
+        head_ += trimmed;
+        lastNearest_ = (lastNearest_ > trimmed) ? lastNearest_ - trimmed : 0;
+
+        if (head_ * 2 >= cumLen_.size()) {
+            Compact();
+        }
+        return trimmed;
+    }
+
+    void SeamPathStore::Compact()
+    {
+        pts_.erase(pts_.begin(), pts_.begin() + head_);
+        cumLen_.erase(cumLen_.begin(), cumLen_.begin() + head_);
+        base_ += head_;
+        head_ = 0;
+
+        // 移除网格中已裁剪的点
+        for (auto it = grid_.begin(); it != grid_.end();) {
+            auto& cell = it->second;
+            cell.erase(std::remove_if(cell.begin(), cell.end(),
+                [this](size_t g) { return g < base_; }), cell.end());
+            it = cell.empty() ? grid_.erase(it) : std::next(it);
+        }
+    }
+
+} // namespace WeldTrackApp
@@ -0,0 +1,104 @@
+#include "RobotMethod/SeamPosFilter.h"
+
+namespace WeldTrackApp {
+
+    SeamPosFilter::SeamPosFilter(double MNoiseCov, double PNoiseCov)
+        : mNoiseCov_(MNoiseCov),
+          pNoiseCov_(PNoiseCov)
+    {
+        // 预计算增益序列，运算顺序与 Cal_KalmanFilter 保持一致
+        double ldv_ProcessData = MacroDefine::KalmanInitCov;
+        for (int t = 1; t < Delay; ++t) {
+            ldv_ProcessData += pNoiseCov_;
+            double ldv_Gain = ldv_ProcessData / (ldv_ProcessData + mNoiseCov_);
+            ldv_ProcessData = (1.0 - ldv_Gain) * ldv_ProcessData;
+            gains_[t] = ldv_Gain;
+        }
+
+        // 查找增益逐位不变的起始步
+        stableFrom_ = Delay - 1;
+        while (stableFrom_ > 1 && gains_[stableFrom_ - 1] == gains_[Delay - 1]) {
+            --stableFrom_;
+        }
+    }
+
+    void SeamPosFilter::Reset()
+    {
+        count_ = 0;
+        fastEst_ = {};
+        stdEst_ = {};
+        stdCov_ = MacroDefine::KalmanInitCov;
+        output_ = {};
+    }
+
+    std::vector<double> SeamPosFilter::Update(const std::vector<double>& meaPt)
+    {
+        if (meaPt.size() < 3) {
+            return GetFilterPt();
+        }
+
+        const Point3d x = { meaPt[0], meaPt[1], meaPt[2] };
+        if (count_ < static_cast<size_t>(Delay)) {
+            history_[count_] = x;
+        }
+        ++count_;
+
+        if (count_ == 1) {
+            // 首点：补点阶段的估计值恒为首点（经一次补点运算以保持符号位一致）
+            for (int k = 0; k < 3; ++k) {
+                fastEst_[k] = x[k] + gains_[1] * (x[k] - x[k]);
+                stdEst_[k] = x[k];
+            }
+        }
+        else {
+            // 标准卡尔曼递推
+            stdCov_ += pNoiseCov_;
+            double stdGain = stdCov_ / (stdCov_ + mNoiseCov_);
+            stdCov_ = (1.0 - stdGain) * stdCov_;
+
+            const double fastGain = gains_[Delay - 1];
+            for (int k = 0; k < 3; ++k) {
+                stdEst_[k] += stdGain * (x[k] - stdEst_[k]);
+                fastEst_[k] += fastGain * (x[k] - fastEst_[k]);
+            }
+        }
+
+        if (count_ >= static_cast<size_t>(Delay)) {
+            output_ = stdEst_;
+        }
+        else if (Delay - static_cast<int>(count_) + 1 >= stableFrom_) {
+            output_ = fastEst_;
+        }
+        else {
+            output_ = Replay();
+        }
+
+        return GetFilterPt();
+    }
+
+    std::vector<double> SeamPosFilter::GetFilterPt() const
+    {
+        return { output_[0], output_[1], output_[2] };
+    }
+
+    SeamPosFilter::Point3d SeamPosFilter::Replay() const
+    {
+        // 补点个数为 Delay - n，第 j 个测量点使用第 Delay - n + j 步的增益
+        const int n = static_cast<int>(count_);
+        const int offset = Delay - n;
+
+        Point3d est;
+        for (int k = 0; k < 3; ++k) {
+            const double x0 = history_[0][k];
+            est[k] = x0 + gains_[1] * (x0 - x0);
+        }
+        for (int j = 1; j < n; ++j) {
+            const double g = gains_[offset + j];
+            for (int k = 0; k < 3; ++k) {
+                est[k] += g * (history_[j][k] - est[k]);
+            }
+        }
+        return est;
+    }
+
+} // namespace WeldTrackApp
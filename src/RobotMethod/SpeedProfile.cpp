@@ -0,0 +1,100 @@
+#include "RobotMethod/SpeedProfile.h"
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include <stdexcept>
+
+namespace WeldTrackApp {
+
+    namespace {
+        void CheckSpeed(double speed)
+        {
+            if (!(speed > 0)) {
+                throw std::invalid_argument("WeldSpeed must be bigger than 0");
+            }
+        }
+    }
+
+    SpeedProfile::SpeedProfile(double baseSpeed, double maxAcc)
+        : maxAcc_(maxAcc)
+    {
+        CheckSpeed(baseSpeed);
+        if (!(maxAcc > 0)) {
+            throw std::invalid_argument("MaxAcc must be bigger than 0");
+        }
+        zones_.push_back({ -std::numeric_limits<double>::infinity(), baseSpeed });
+    }
+
+    size_t SpeedProfile::ZoneIndex(double s) const
+    {
+        // 最后一个起点 <= s 的分段
+        auto it = std::upper_bound(zones_.begin(), zones_.end(), s,
+            [](double value, const Zone& zone) { return value < zone.s; });
+        return static_cast<size_t>(it - zones_.begin()) - 1;
+    }
+
+    void SpeedProfile::SetSpeed(double s, double speed)
+    {
+        CheckSpeed(speed);
+        // 删除起点 >= s 的分段（首个分段保留）
+        auto it = std::lower_bound(zones_.begin() + 1, zones_.end(), s,
+            [](const Zone& zone, double value) { return zone.s < value; });
+        zones_.erase(it, zones_.end());
+        zones_.push_back({ s, speed });
+    }
+
+    void SpeedProfile::SetSpeedRange(double s0, double s1, double speed)
+    {
+        CheckSpeed(speed);
+        if (!(s1 > s0)) {
+            throw std::invalid_argument("speed range end must be bigger than start");
+        }
+        const double resume = TargetAt(s1);
+        auto first = std::lower_bound(zones_.begin() + 1, zones_.end(), s0,
+            [](const Zone& zone, double value) { return zone.s < value; });
+        auto last = std::upper_bound(first, zones_.end(), s1,
+            [](double value, const Zone& zone) { return value < zone.s; });
+        first = zones_.erase(first, last);
+        zones_.insert(first, { { s0, speed }, { s1, resume } });
+    }
+
+    double SpeedProfile::TargetAt(double s) const
+    {
+        return zones_[ZoneIndex(s)].speed;
+    }
+
+    double SpeedProfile::SpeedAt(double s) const
+    {
+        // 每个分段对 s 处速度的约束：v^2 <= v_j^2 + 2a * (s 到该分段的距离)，取最小值，
+        // 得到的曲线连续且加减速度不超过 maxAcc
+        double v2 = std::numeric_limits<double>::infinity();
+        for (size_t j = 0; j < zones_.size(); ++j) {
+            const double begin = zones_[j].s;
+            const double end = (j + 1 < zones_.size()) ? zones_[j + 1].s : std::numeric_limits<double>::infinity();
+            double dist = 0.0;
+            if (s < begin) {
+                dist = begin - s;
+            }
+            else if (s > end) {
+                dist = s - end;
+            }
+            v2 = std::min(v2, zones_[j].speed * zones_[j].speed + 2 * maxAcc_ * dist);
+        }
+        return std::sqrt(v2);
+    }
+
+    double SpeedProfile::MaxSpeedFrom(double s) const
+    {
+        double vMax = 0.0;
+        for (size_t j = ZoneIndex(s); j < zones_.size(); ++j) {
+            vMax = std::max(vMax, zones_[j].speed);
+        }
+        return vMax;
+    }
+
+    double SpeedProfile::RampDistance(double v0, double v1) const
+    {
+        return std::fabs(v0 * v0 - v1 * v1) / (2 * maxAcc_);
+    }
+
+} // namespace WeldTrackApp
@@ -0,0 +1,367 @@
+#include "RobotMethod/SplinePlanner.h"
+#include <cmath>
+#include <algorithm>
+#include <stdexcept>
+
+namespace WeldTrackApp {
+
+    namespace {
+        using Point3d = SplinePlanner::Point3d;
+
+        // 均匀三次 B 样条段求值，u ∈ [0, 1]
+        Point3d EvalBSpline(const std::array<Point3d, 4>& p, double u)
+        {
+            const double u2 = u * u;
+            const double u3 = u2 * u;
+            const double b0 = (1 - u) * (1 - u) * (1 - u) / 6.0;
+            const double b1 = (3 * u3 - 6 * u2 + 4) / 6.0;
+            const double b2 = (-3 * u3 + 3 * u2 + 3 * u + 1) / 6.0;
+            const double b3 = u3 / 6.0;
+            Point3d pt;
+            for (int i = 0; i < 3; ++i) {
+                pt[i] = b0 * p[0][i] + b1 * p[1][i] + b2 * p[2][i] + b3 * p[3][i];
+            }
+            return pt;
+        }
+
+        // 均匀三次 B 样条段的曲率
+        double Curvature(const std::array<Point3d, 4>& p, double u)
+        {
+            const double d1[4] = { -(1 - u) * (1 - u) / 2, (3 * u * u - 4 * u) / 2,
+                                   (-3 * u * u + 2 * u + 1) / 2, u * u / 2 };
+            const double d2[4] = { 1 - u, 3 * u - 2, -3 * u + 1, u };
+            double t[3] = { 0.0, 0.0, 0.0 };
+            double n[3] = { 0.0, 0.0, 0.0 };
+            for (int i = 0; i < 3; ++i) {
+                for (int j = 0; j < 4; ++j) {
+                    t[i] += d1[j] * p[j][i];
+                    n[i] += d2[j] * p[j][i];
+                }
+            }
+            const double tLen = std::sqrt(t[0] * t[0] + t[1] * t[1] + t[2] * t[2]);
+            if (tLen < 1e-9) {
+                return 0.0;
+            }
+            const double cx = t[1] * n[2] - t[2] * n[1];
+            const double cy = t[2] * n[0] - t[0] * n[2];
+            const double cz = t[0] * n[1] - t[1] * n[0];
+            return std::sqrt(cx * cx + cy * cy + cz * cz) / (tLen * tLen * tLen);
+        }
+
+        // 插值方程逆的系数：P[j] = Σ w[|k|] * Q[j + k]，|k| <= LookAhead；
+        // 窗口外的项按窗口边缘的点延拓并入 w[LookAhead]，系数和为 1
+        const std::array<double, SplinePlanner::LookAhead + 1>& DeBoorWeights()
+        {
+            static const std::array<double, SplinePlanner::LookAhead + 1> weights = [] {
+                const double r = 2.0 - std::sqrt(3.0);
+                std::array<double, SplinePlanner::LookAhead + 1> w = {};
+                double pw = 1.0;
+                for (int k = 0; k <= SplinePlanner::LookAhead; ++k) {
+                    w[k] = std::sqrt(3.0) * pw;
+                    pw *= -r;
+                }
+                w[SplinePlanner::LookAhead] += std::sqrt(3.0) * pw / (1.0 + r);
+                return w;
+            }();
+            return weights;
+        }
+
+        double Distance(const Point3d& a, const Point3d& b)
+        {
+            const double dx = a[0] - b[0];
+            const double dy = a[1] - b[1];
+            const double dz = a[2] - b[2];
+            return std::sqrt(dx * dx + dy * dy + dz * dz);
+        }
+    }
+
+    SplinePlanner::SplinePlanner(double totalLen, const std::vector<double>& totalIncAtt,
+        double speed, double maxAcc)
+        : profile_(speed, maxAcc), maxAcc_(maxAcc)
+    {
+        Reset(totalLen, totalIncAtt);
+    }
+
+    void SplinePlanner::Reset(double totalLen, const std::vector<double>& totalIncAtt)
+    {
+        if (totalLen <= 0) {
+            throw std::invalid_argument("TotalLen must be bigger than 0");
+        }
+        totalLen_ = totalLen;
+        for (size_t i = 0; i < 3; ++i) {
+            totalIncAtt_[i] = (i < totalIncAtt.size()) ? totalIncAtt[i] : 0.0;
+        }
+        dataPts_.Clear();
+        ctrlPts_.Clear();
+        lastPt_.clear();
+        ptCount_ = 0;
+        nextBoor_ = -1;
+        finished_ = false;
+        segs_.Clear();
+        knownLen_ = 0.0;
+        plannedLen_ = 0.0;
+        curSpeed_ = 0.0;
+        origin_ = {};
+        std::fill(std::begin(emitted_), std::end(emitted_), 0LL);
+    }
+
+    void SplinePlanner::SetSpeed(double speed)
+    {
+        profile_.SetSpeed(plannedLen_, speed);
+    }
+
+    void SplinePlanner::SetSpeedProfile(const SpeedProfile& profile)
+    {
+        profile_ = profile;
+    }
+
+    size_t SplinePlanner::PushPoint(const std::vector<double>& pt, std::vector<IncPt>& incDatas)
+    {
+        if (pt.size() < 3) {
+            throw std::invalid_argument("input point must be 3 - dimensional");
+        }
+        if (finished_) {
+            throw std::logic_error("SplinePlanner already finished, call Reset first");
+        }
+
+        if (ptCount_ == 0) {
+            origin_ = { pt[0], pt[1], pt[2] };
+        }
+        // 距离过近的点跳过
+        else if (!alg_.Inter_Decision(lastPt_, pt)) {
+            return 0;
+        }
+
+        dataPts_.PushOverwrite({ pt[0], pt[1], pt[2] });
+        lastPt_.assign(pt.begin(), pt.end());
+        ++ptCount_;
+
+        // 第 j 个 de Boor 点需要其后 LookAhead 个控制点；靠近首点时还需要反射延拓所用的控制点
+        const long long n = static_cast<long long>(ptCount_);
+        if (n < LookAhead + 2) {
+            return 0;
+        }
+        return AppendDeBoorPts(n - 1 - LookAhead, incDatas);
+    }
+
+    size_t SplinePlanner::Finish(std::vector<IncPt>& incDatas)
+    {
+        if (finished_) {
+            return 0;
+        }
+        finished_ = true;
+        if (ptCount_ < 2) {
+            return 0;
+        }
+
+        // 末点之后按末点延拓，求出剩余的 de Boor 点，最后一段终止于末点
+        size_t count = AppendDeBoorPts(static_cast<long long>(ptCount_), incDatas);
+        return count + Plan(true, incDatas);
+    }
+
+    std::vector<double> SplinePlanner::CurPos() const
+    {
+        return { origin_[0] + emitted_[0] / 1000.0,
+                 origin_[1] + emitted_[1] / 1000.0,
+                 origin_[2] + emitted_[2] / 1000.0 };
+    }
+
+    SplinePlanner::Point3d SplinePlanner::DataPoint(long long m) const
+    {
+        // 序号超出 [0, ptCount_) 的控制点以首末点为中心反射延拓（Finish 前只会用到首点一侧）
+        const long long n = static_cast<long long>(ptCount_);
+        if (m < 0 || m > n - 1) {
+            const long long edge = (m < 0) ? 0 : n - 1;
+            const Point3d e = DataPoint(edge);
+            const Point3d q = DataPoint(2 * edge - m);
+            return { 2 * e[0] - q[0], 2 * e[1] - q[1], 2 * e[2] - q[2] };
+        }
+        const long long first = n - static_cast<long long>(dataPts_.Size());
+        return dataPts_[static_cast<size_t>(m - first)];
+    }
+
+    SplinePlanner::Point3d SplinePlanner::DeBoorPoint(long long j) const
+    {
+        const auto& w = DeBoorWeights();
+        Point3d p = {};
+        for (long long k = -LookAhead; k <= LookAhead; ++k) {
+            const Point3d q = DataPoint(j + k);
+            const double wk = w[static_cast<size_t>(k < 0 ? -k : k)];
+            for (int i = 0; i < 3; ++i) {
+                p[i] += wk * q[i];
+            }
+        }
+        return p;
+    }
+
+    size_t SplinePlanner::AppendDeBoorPts(long long last, std::vector<IncPt>& incDatas)
+    {
+        // 每个 de Boor 点至多产生一个样条段，逐段规划以保证段缓冲区有空间
+        size_t count = 0;
+        while (nextBoor_ <= last) {
+            AppendCtrlPt(DeBoorPoint(nextBoor_++));
+            count += Plan(false, incDatas);
+        }
+        return count;
+    }
+
+    void SplinePlanner::AppendCtrlPt(const Point3d& pt)
+    {
+        ctrlPts_.PushOverwrite(pt);
+        if (ctrlPts_.Full()) {
+            AppendSegment();
+        }
+    }
+
+    void SplinePlanner::AppendSegment()
+    {
+        Segment seg;
+        for (size_t i = 0; i < 4; ++i) {
+            seg.ctrl[i] = ctrlPts_[i];
+        }
+
+        // 弧长表：按等参数采样的弦长累加；同时取采样点最大曲率
+        Point3d prev = EvalBSpline(seg.ctrl, 0.0);
+        seg.arcLen[0] = 0.0;
+        double maxCurv = Curvature(seg.ctrl, 0.0);
+        for (int k = 1; k <= SegSampleNum; ++k) {
+            const double u = static_cast<double>(k) / SegSampleNum;
+            Point3d cur = EvalBSpline(seg.ctrl, u);
+            seg.arcLen[k] = seg.arcLen[k - 1] + Distance(prev, cur);
+            maxCurv = std::max(maxCurv, Curvature(seg.ctrl, u));
+            prev = cur;
+        }
+        // 向心加速度 v^2 * k 不超过最大加速度
+        seg.vLimit = (maxCurv > 0.0) ? std::sqrt(maxAcc_ / maxCurv) : HUGE_VAL;
+
+        // 退化段不含路径
+        if (seg.arcLen[SegSampleNum] <= 0.0) {
+            return;
+        }
+
+        // Plan() 保证缓冲区在每次追加前未满
+        if (segs_.Full()) {
+            throw std::length_error("SplinePlanner segment buffer is full");
+        }
+
+        seg.startLen = knownLen_;
+        knownLen_ += seg.arcLen[SegSampleNum];
+        segs_.Push(seg);
+    }
+
+    SplinePlanner::Point3d SplinePlanner::Evaluate(double s) const
+    {
+        // 二分查找 s 所在的段
+        size_t lo = 0;
+        size_t hi = segs_.Size() - 1;
+        while (lo < hi) {
+            size_t mid = (lo + hi + 1) / 2;
+            if (segs_[mid].startLen <= s) {
+                lo = mid;
+            }
+            else {
+                hi = mid - 1;
+            }
+        }
+        const Segment& seg = segs_[lo];
+
+        // 弧长表中二分查找，线性插值得到参数 u
+        const double local = std::min(std::max(s - seg.startLen, 0.0), seg.arcLen[SegSampleNum]);
+        auto it = std::upper_bound(seg.arcLen.begin() + 1, seg.arcLen.end(), local);
+        if (it == seg.arcLen.end()) {
+            return EvalBSpline(seg.ctrl, 1.0);
+        }
+        const int k = static_cast<int>(it - seg.arcLen.begin());
+        const double span = seg.arcLen[k] - seg.arcLen[k - 1];
+        const double frac = (span > 0.0) ? (local - seg.arcLen[k - 1]) / span : 0.0;
+        return EvalBSpline(seg.ctrl, (k - 1 + frac) / SegSampleNum);
+    }
+
+    size_t SplinePlanner::Plan(bool toEnd, std::vector<IncPt>& incDatas)
+    {
+        const double dt = MacroDefine::InterCycle;
+        const double dv = maxAcc_ * dt;
+        size_t count = 0;
+
+        while (!segs_.Empty()) {
+            const double remain = knownLen_ - plannedLen_;
+            if (remain <= 1e-9) {
+                break;
+            }
+
+            // 前瞻余量：以设定速度减速到零所需距离加一个周期，余量内的路径等待后续控制点；
+            // 段缓冲区已满时继续执行，为下一段腾出空间（速度规划仍保证可停止）
+            const double vMax = std::max(profile_.MaxSpeedFrom(plannedLen_), curSpeed_);
+            const double reserve = vMax * vMax / (2 * maxAcc_) + vMax * dt;
+            if (!toEnd && remain < reserve && !segs_.Full()) {
+                break;
+            }
+
+            // 梯形速度规划：向速度曲线在本周期起止处的较低速度加减速，且保证在已知路径末端能够停止
+            const double target = std::min(profile_.SpeedAt(plannedLen_),
+                profile_.SpeedAt(plannedLen_ + curSpeed_ * dt));
+            double v = curSpeed_ + std::min(std::max(target - curSpeed_, -dv), dv);
+            v = std::min(v, BrakeSpeed(remain, 0.0));
+
+            // 前瞻：当前段及制动距离内的后续段按曲率限速
+            for (size_t i = 0; i < segs_.Size(); ++i) {
+                const Segment& seg = segs_[i];
+                const double dist = seg.startLen - plannedLen_;
+                if (dist > reserve) {
+                    break;
+                }
+                v = std::min(v, BrakeSpeed(std::max(dist, 0.0), seg.vLimit));
+            }
+
+            double step = v * dt;
+            if (step >= remain || (toEnd && remain - step < 1e-9)) {
+                step = remain;
+                v = step / dt;
+            }
+            plannedLen_ += step;
+            curSpeed_ = v;
+            EmitCycle(incDatas);
+            ++count;
+
+            // 已执行完的段出队，保留当前所在段
+            while (segs_.Size() > 1 && segs_[1].startLen <= plannedLen_) {
+                segs_.PopFront();
+            }
+        }
+
+        if (toEnd) {
+            curSpeed_ = 0.0;
+        }
+        return count;
+    }
+
+    double SplinePlanner::BrakeSpeed(double dist, double vEnd) const
+    {
+        // 以 maxAcc 逐周期减速，在 dist 内降到 vEnd 所允许的最大速度
+        if (std::isinf(vEnd)) {
+            return HUGE_VAL;
+        }
+        const double dv = maxAcc_ * MacroDefine::InterCycle;
+        return -dv / 2 + std::sqrt(dv * dv / 4 + vEnd * vEnd + 2 * maxAcc_ * dist);
+    }
+
+    void SplinePlanner::EmitCycle(std::vector<IncPt>& incDatas)
+    {
+        const Point3d pos = Evaluate(plannedLen_);
+
+        // 按累计值取整，量化误差不随周期累积
+        long long cum[6];
+        for (int i = 0; i < 3; ++i) {
+            cum[i] = std::llround((pos[i] - origin_[i]) * 1000);
+            cum[i + 3] = std::llround(totalIncAtt_[i] * plannedLen_ / totalLen_ * 10000);
+        }
+
+        IncPt inc;
+        for (int i = 0; i < 6; ++i) {
+            inc.d[i] = static_cast<int32_t>(cum[i] - emitted_[i]);
+            emitted_[i] = cum[i];
+        }
+        incDatas.push_back(inc);
+    }
+
+} // namespace WeldTrackApp
@@ -11,28 +11,29 @@ namespace WeldTrackApp {
         std::vector<double>& IncAtt,
         double& totalLen)
     {
-        // ʼ
+        // 初始化输出参数
         IncAtt.clear();
         IncAtt.resize(3, 0.0);
         totalLen = 0.0;
+        residual_ = {};
 
         if (mea_Pos.size() < 2) {
             return false;
         }
 
-        // ȡͽ̬
+        // 获取起点和结束点的姿态
         const auto& startPoint = mea_Pos[0];
         const auto& endPoint = mea_Pos.back();
 
         double startAtt[3] = { startPoint[3], startPoint[4], startPoint[5] };
         double endAtt[3] = { endPoint[3], endPoint[4], endPoint[5] };
 
-        // ̬
+        // 计算姿态增量
         IncAtt[0] = Cal_IncAtt(startAtt[0], endAtt[0]);
         IncAtt[1] = Cal_IncAtt(startAtt[1], endAtt[1]);
         IncAtt[2] = Cal_IncAtt(startAtt[2], endAtt[2]);
 
-        // 㺸ӹ켣
+        // 计算焊接轨迹长度
         for (size_t i = 0; i < mea_Pos.size() - 1; ++i) {
             double len = Cal_Length(mea_Pos[i], mea_Pos[i + 1]);
             totalLen += len;
@@ -41,18 +42,26 @@ namespace WeldTrackApp {
         return true;
     }
 
+    void TrackAlgMethod::SetWeldSpeed(double speed)
+    {
+        if (speed <= 0) {
+            throw std::invalid_argument("WeldSpeed must be bigger than 0");
+        }
+        weldSpeed_ = speed;
+    }
+
     double TrackAlgMethod::Cal_IncAtt(double Start, double End) {
-        // 1. ԭʼǶȲ
+        // 1. 计算原始角度差
         double diff = End - Start;
 
-        // 2. һ[-180, 180]
-        diff = std::fmod(diff, 360.0); // ȡģ(-360, 360)
+        // 2. 归一化到[-180°, 180°]区间
+        diff = std::fmod(diff, 360.0); // 先取模到(-360, 360)
 
-        // 3. [0, 360)Χ
+        // 3. 调整到[0, 360)范围
         if (diff < 0.0) {
             diff += 360.0;
         }
-        // 4. ӳ䵽[-180, 180]
+        // 4. 映射到[-180°, 180°]
         if (diff > 180.0) {
             diff -= 360.0;
         }
@@ -63,7 +72,7 @@ namespace WeldTrackApp {
         const std::vector<double>& firstPt,
         const std::vector<double>& secondPt)
     {
-        // ȷЧ
+        // 确保点数据有效
         if (firstPt.size() < 3 || secondPt.size() < 3) {
             throw std::invalid_argument("input point must be 3 - dimensional");
         }
@@ -81,56 +90,121 @@ namespace WeldTrackApp {
         double TotalLen,
         const std::vector<double>& TotalIncAtt)
     {
+        std::vector<IncPt> incPts;
+        Cal_InterPt(firstPt, secondPt, TotalLen, TotalIncAtt, incPts);
+
         std::vector<std::vector<int>> Inter_Pts;
+        Inter_Pts.reserve(incPts.size());
+        for (const auto& pt : incPts) {
+            Inter_Pts.emplace_back(pt.d, pt.d + 6);
+        }
+        return Inter_Pts;
+    }
 
-        // 
+    size_t TrackAlgMethod::Cal_InterPt(
+        const std::vector<double>& firstPt,
+        const std::vector<double>& secondPt,
+        double TotalLen,
+        const std::vector<double>& TotalIncAtt,
+        std::vector<IncPt>& Inter_Pts)
+    {
+        // 计算两点距离
         double Len = Cal_Length(firstPt, secondPt);
         
         if (Len > TotalLen) {
             throw std::invalid_argument("TotalLen less than distance between points");
         }
 
-        // 岹
-        int InterNum = static_cast<int>(Len / (MacroDefine::WeldSpeed * MacroDefine::InterCycle));
+        // 计算插补点数量
+        int InterNum = static_cast<int>(Len / (weldSpeed_ * MacroDefine::InterCycle));
 
         if (InterNum == 0) {
-            return Inter_Pts;
+            return 0;
         }
 
-        // ÿ岹̬֮
-        std::vector<int> CurIncAtt(TotalIncAtt.size(), 0);
+        // 计算每个插补点之间的姿态增量
+        if (TotalLen <= 0) {
+            throw std::invalid_argument("TotalLen must be bigger than 0");
+        }
+        int CurIncAtt[3] = { 0, 0, 0 };
+        for (size_t i = 0; i < std::min<size_t>(TotalIncAtt.size(), 3); ++i) {
+            double inc = TotalIncAtt[i] * Len / (TotalLen * InterNum);
+            CurIncAtt[i] = static_cast<int>(inc * 10000);  // 转换为 0.0001 度单位
+        }
 
-        if (TotalLen > 0) {
-            for (size_t i = 0; i < TotalIncAtt.size(); ++i) {
-                double inc = TotalIncAtt[i] * Len / (TotalLen * InterNum);
-                CurIncAtt[i] = static_cast<int>(inc * 10000);  // תΪ 0.0001 ȵλ
-            }
+        // 计算每个插补点之间的位置增量
+        int CurIncPos[3] = { 0, 0, 0 };
+        for (int i = 0; i < 3; ++i) {
+            double inc = (secondPt[i] - firstPt[i]) / InterNum;
+            CurIncPos[i] = static_cast<int>(inc * 1000);  // 转换为 0.001 mm 单位
         }
-        else {
+
+        // 生成插补点
+        IncPt Inter_Pt;
+        Inter_Pt.d[0] = CurIncPos[0];
+        Inter_Pt.d[1] = CurIncPos[1];
+        Inter_Pt.d[2] = 0;  // Z轴增量设为0（安全考虑）
+        Inter_Pt.d[3] = CurIncAtt[0];
+        Inter_Pt.d[4] = CurIncAtt[1];
+        Inter_Pt.d[5] = CurIncAtt[2];
+
+        Inter_Pts.insert(Inter_Pts.end(), static_cast<size_t>(InterNum), Inter_Pt);
+        return static_cast<size_t>(InterNum);
+    }
+
+    size_t TrackAlgMethod::Cal_InterPt(
+        const std::vector<double>& firstPt,
+        const std::vector<double>& secondPt,
+        double TotalLen,
+        const std::vector<double>& TotalIncAtt,
+        IncResidual& residual,
+        std::vector<IncPt>& Inter_Pts)
+    {
+        // 计算两点距离
+        double Len = Cal_Length(firstPt, secondPt);
+
+        if (Len > TotalLen) {
+            throw std::invalid_argument("TotalLen less than distance between points");
+        }
+        if (TotalLen <= 0) {
             throw std::invalid_argument("TotalLen must be bigger than 0");
         }
 
-        // ÿ岹֮λ
-        std::vector<int> CurIncPos(3, 0);
+        // 计算插补点数量
+        int InterNum = static_cast<int>(Len / (weldSpeed_ * MacroDefine::InterCycle));
+
+        if (InterNum == 0) {
+            return 0;
+        }
+
+        // 本段各轴目标增量（含上一段余量），位置 0.001 mm 单位，姿态 0.0001 度单位
+        double target[6] = { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 };
         for (int i = 0; i < 3; ++i) {
-            double inc = (secondPt[i] - firstPt[i]) / InterNum;
-            CurIncPos[i] = static_cast<int>(inc * 1000);  // תΪ 0.001 mm λ
+            target[i] = (secondPt[i] - firstPt[i]) * 1000 + residual[i];
+        }
+        for (size_t i = 0; i < 3; ++i) {
+            double inc = (i < TotalIncAtt.size()) ? TotalIncAtt[i] * Len / TotalLen : 0.0;
+            target[i + 3] = inc * 10000 + residual[i + 3];
         }
 
-        // ɲ岹
-        for (int i = 0; i < InterNum; ++i) {
-            std::vector<int> Inter_Pt(6, 0);
-            Inter_Pt[0] = CurIncPos[0];
-            Inter_Pt[1] = CurIncPos[1];
-            Inter_Pt[2] = 0;  // ZΪ0ȫǣ
-            Inter_Pt[3] = CurIncAtt[0];
-            Inter_Pt[4] = CurIncAtt[1];
-            Inter_Pt[5] = CurIncAtt[2];
-
-            Inter_Pts.push_back(Inter_Pt);
+        // 按累计值取整生成增量，相邻周期的增量最多相差一个单位
+        const size_t oldSize = Inter_Pts.size();
+        Inter_Pts.resize(oldSize + static_cast<size_t>(InterNum));
+        long long emitted[6] = { 0, 0, 0, 0, 0, 0 };
+        for (int k = 1; k <= InterNum; ++k) {
+            IncPt& Inter_Pt = Inter_Pts[oldSize + k - 1];
+            for (int i = 0; i < 6; ++i) {
+                long long cum = std::llround(target[i] * k / InterNum);
+                Inter_Pt.d[i] = static_cast<int32_t>(cum - emitted[i]);
+                emitted[i] = cum;
+            }
         }
 
-        return Inter_Pts;
+        // 保留不足一个单位的余量到下一段
+        for (int i = 0; i < 6; ++i) {
+            residual[i] = target[i] - static_cast<double>(emitted[i]);
+        }
+        return static_cast<size_t>(InterNum);
     }
 
     double TrackAlgMethod::Cal_totalLength(
@@ -143,13 +217,13 @@ namespace WeldTrackApp {
         }
 
         for (size_t i = 0; i < trackDatas_Save.size() - 1; ++i) {
-            // ȡλ
+            // 提取相邻两点的位置
             const auto& pt1 = trackDatas_Save[i];
             const auto& pt2 = trackDatas_Save[i + 1];
 
-            // ȷݸʽȷ
-            if (pt1.size() >= 3 && pt2.size() >= 3) {
-                // Ӧбݵ(x, y, z) ά // ȷ
+            // 确保数据格式正确，位置位于第 5-7 个元素
+            if (pt1.size() >= 8 && pt2.size() >= 8) {
+                // 对应主程序中保存数据的(x, y, z) 维度 // 待确认
                 std::vector<double> pos1 = { pt1[5], pt1[6], pt1[7] };
                 std::vector<double> pos2 = { pt2[5], pt2[6], pt2[7] };
 
@@ -169,43 +243,48 @@ namespace WeldTrackApp {
         double totalLen,
         const std::vector<double>& totalIncAtt)
     {
+        std::vector<IncPt> incPts;
+        Gen_BatchTrackIncPtData(In_trackDatas_Control, totalLen, totalIncAtt, incPts);
+
         std::vector<std::vector<int>> all_IncDatas;
+        all_IncDatas.reserve(incPts.size());
+        for (const auto& pt : incPts) {
+            all_IncDatas.emplace_back(pt.d, pt.d + 6);
+        }
+        return all_IncDatas;
+    }
 
+    size_t TrackAlgMethod::Gen_BatchTrackIncPtData(
+        std::vector<std::vector<double>>& In_trackDatas_Control,
+        double totalLen,
+        const std::vector<double>& totalIncAtt,
+        std::vector<IncPt>& all_IncDatas)
+    {
         if (In_trackDatas_Control.size() < 2) {
-            return all_IncDatas;
+            return 0;
         }
 
-        // еĲ岹ݼȥ̵ĵ㣩
-        std::vector<std::vector<double>> trackDatas_Control_Feasible;
-        trackDatas_Control_Feasible.push_back(In_trackDatas_Control[0]);
-
+        // 逐点筛选可行的插补点（去除距离过短的点），直接生成插补增量
+        size_t count = 0;
+        size_t feasibleNum = 1;
+        size_t lastIdx = 0;
         for (size_t i = 1; i < In_trackDatas_Control.size(); ++i) {
-            const auto& firstPt = trackDatas_Control_Feasible.back();
+            const auto& firstPt = In_trackDatas_Control[lastIdx];
             const auto& secondPt = In_trackDatas_Control[i];
 
             if (Inter_Decision(firstPt, secondPt)) {
-                trackDatas_Control_Feasible.push_back(secondPt);
+                count += Cal_InterPt(firstPt, secondPt, totalLen, totalIncAtt, residual_, all_IncDatas);
+                lastIdx = i;
+                ++feasibleNum;
             }
         }
 
-        // 岹
-        if (trackDatas_Control_Feasible.size() > 1) {
-            for (size_t i = 0; i < trackDatas_Control_Feasible.size() - 1; ++i) {
-                auto interPts = Cal_InterPt(
-                    trackDatas_Control_Feasible[i],
-                    trackDatas_Control_Feasible[i + 1],
-                    totalLen,
-                    totalIncAtt);
-
-                all_IncDatas.insert(all_IncDatas.end(), interPts.begin(), interPts.end());
-            }
-            // ƳѴ
-            if (!In_trackDatas_Control.empty()) {
-                In_trackDatas_Control.erase(In_trackDatas_Control.begin(),
-                    In_trackDatas_Control.begin() + In_trackDatas_Control.size() - 1);
-            }
+        // 移除已处理的数据
+        if (feasibleNum > 1) {
+            In_trackDatas_Control.erase(In_trackDatas_Control.begin(),
+                In_trackDatas_Control.begin() + In_trackDatas_Control.size() - 1);
         }
-        return all_IncDatas;
+        return count;
     }
 
     bool TrackAlgMethod::Inter_Decision(
@@ -213,7 +292,7 @@ namespace WeldTrackApp {
         const std::vector<double>& secondPt)
     {
         double Len = Cal_Length(firstPt, secondPt);
-        int InterNum = static_cast<int>(Len / (MacroDefine::WeldSpeed * MacroDefine::InterCycle));
+        int InterNum = static_cast<int>(Len / (weldSpeed_ * MacroDefine::InterCycle));
         return (InterNum > 0);
     }
 
@@ -226,7 +305,7 @@ namespace WeldTrackApp {
         std::vector<double> y_trackDatas_Save;
         std::vector<double> z_trackDatas_Save;
 
-        // ȡ XYZ   // ȷ
+        // 提取 XYZ 坐标数据  // 待确认
         for (const auto& data : trackDatas_Save) {
             if (data.size() >= 3) {
                 x_trackDatas_Save.push_back(data[0]);
@@ -240,14 +319,18 @@ namespace WeldTrackApp {
             return { 0.0, 0.0, 0.0 };
         }
 
-        // ݲ㲿
-        for (size_t i = 0; i < MacroDefine::filterDelay - cur_Count; ++i) {
-            x_trackDatas_Save.insert(x_trackDatas_Save.begin(), x_trackDatas_Save[0]);
-            y_trackDatas_Save.insert(y_trackDatas_Save.begin(), y_trackDatas_Save[0]);
-            z_trackDatas_Save.insert(z_trackDatas_Save.begin(), z_trackDatas_Save[0]);
+        // 补充数据不足部分（超过 filterDelay 时不补充）
+        if (cur_Count < static_cast<size_t>(MacroDefine::filterDelay)) {
+            size_t padNum = MacroDefine::filterDelay - cur_Count;
+            double x0 = x_trackDatas_Save[0];
+            double y0 = y_trackDatas_Save[0];
+            double z0 = z_trackDatas_Save[0];
+            x_trackDatas_Save.insert(x_trackDatas_Save.begin(), padNum, x0);
+            y_trackDatas_Save.insert(y_trackDatas_Save.begin(), padNum, y0);
+            z_trackDatas_Save.insert(z_trackDatas_Save.begin(), padNum, z0);
         }
 
-        // Ӧÿ˲
+        // 应用卡尔曼滤波
         std::vector<double> x_Filter = Cal_KalmanFilter(x_trackDatas_Save, MNoiseCov, PNoiseCov);
         std::vector<double> y_Filter = Cal_KalmanFilter(y_trackDatas_Save, MNoiseCov, PNoiseCov);
         std::vector<double> z_Filter = Cal_KalmanFilter(z_trackDatas_Save, MNoiseCov, PNoiseCov);
@@ -271,17 +354,17 @@ namespace WeldTrackApp {
         size_t n = ilv_MeasureDatas.size();
         std::vector<double> ldv_EstimationDatas(n, 0.0);
         double ldv_Gain = 0.0;
-        double ldv_ProcessData = 10.0;  // ʼֵ
+        double ldv_ProcessData = MacroDefine::KalmanInitCov;  // 初始过程值
 
-        // ʼֵ
+        // 初始估计值
         ldv_EstimationDatas[0] = ilv_MeasureDatas[0];
 
         for (size_t i = 1; i < n; ++i) {
-            // Ԥⲽ
+            // 预测步骤
             ldv_EstimationDatas[i] = ldv_EstimationDatas[i - 1];
             ldv_ProcessData += idv_PNoiseCov;
 
-            // ²
+            // 更新步骤
             ldv_Gain = ldv_ProcessData / (ldv_ProcessData + idv_MNoiseCov);
             ldv_EstimationDatas[i] += ldv_Gain * (ilv_MeasureDatas[i] - ldv_EstimationDatas[i]);
             ldv_ProcessData = (1.0 - ldv_Gain) * ldv_ProcessData;
@@ -0,0 +1,68 @@
+#include "RobotMethod/TrackInterpolator.h"
+#include <stdexcept>
+
+namespace WeldTrackApp {
+
+    TrackInterpolator::TrackInterpolator(double totalLen, const std::vector<double>& totalIncAtt)
+    {
+        Reset(totalLen, totalIncAtt);
+    }
+
+    void TrackInterpolator::Reset(double totalLen, const std::vector<double>& totalIncAtt)
+    {
+        if (totalLen <= 0) {
+            throw std::invalid_argument("TotalLen must be bigger than 0");
+        }
+        totalLen_ = totalLen;
+        totalIncAtt_ = totalIncAtt;
+        anchor_.clear();
+        hasAnchor_ = false;
+        residual_ = {};
+        travelled_ = 0.0;
+        ctrlPts_.Clear();
+        droppedPts_ = 0;
+    }
+
+    void TrackInterpolator::SetWeldSpeed(double speed)
+    {
+        const double current = profile_.SpeedAt(travelled_);
+        double from = travelled_;
+        if (speed < current) {
+            from += profile_.RampDistance(current, speed);
+        }
+        profile_.SetSpeed(from, speed);
+    }
+
+    size_t TrackInterpolator::PushPoint(const std::vector<double>& pt,
+        std::vector<IncPt>& incDatas)
+    {
+        if (pt.size() < 3) {
+            throw std::invalid_argument("input point must be 3 - dimensional");
+        }
+
+        // 第一个点只作为插补起点
+        if (!hasAnchor_) {
+            anchor_.assign(pt.begin(), pt.end());
+            hasAnchor_ = true;
+            ctrlPts_.PushOverwrite({ pt[0], pt[1], pt[2] });
+            return 0;
+        }
+
+        // 本段按速度曲线在当前弧长处的速度插补
+        alg_.SetWeldSpeed(profile_.SpeedAt(travelled_));
+
+        // 距离过近的点跳过，下一个点仍从当前起点插补
+        if (!alg_.Inter_Decision(anchor_, pt)) {
+            ++droppedPts_;
+            return 0;
+        }
+
+        size_t count = alg_.Cal_InterPt(anchor_, pt, totalLen_, totalIncAtt_, residual_, incDatas);
+        travelled_ += alg_.Cal_Length(anchor_, pt);
+
+        anchor_.assign(pt.begin(), pt.end());
+        ctrlPts_.PushOverwrite({ pt[0], pt[1], pt[2] });
+        return count;
+    }
+
+} // namespace WeldTrackApp
@@ -0,0 +1,223 @@
+#include "RobotMethod/TrackSimulator.h"
+#include "RobotMethod/LaserCoordToTcp.h"
+#include "RobotMethod/SeamPosFilter.h"
+#include "RobotMethod/HampelFilter.h"
+#include "RobotMethod/SeamPathStore.h"
+#include "RobotMethod/TrackInterpolator.h"
+#include "RobotMethod/SpeedProfile.h"
+#include "WorkStealingPool.h"
+#include <cmath>
+#include <chrono>
+#include <optional>
+#include <algorithm>
+#include <stdexcept>
+
+namespace WeldTrackApp {
+
+    namespace {
+        constexpr double TimeEps = 1e-9;
+
+        using Point3d = SeamPathStore::Point3d;
+
+        // 点到线段的距离
+        double SegmentDist(const Point3d& p, const Point3d& a, const Point3d& b)
+        {
+            double ab[3], ap[3];
+            double abLen2 = 0.0, dot = 0.0;
+            for (int i = 0; i < 3; ++i) {
+                ab[i] = b[i] - a[i];
+                ap[i] = p[i] - a[i];
+                abLen2 += ab[i] * ab[i];
+                dot += ab[i] * ap[i];
+            }
+            const double u = (abLen2 > 0) ? std::clamp(dot / abLen2, 0.0, 1.0) : 0.0;
+            double d2 = 0.0;
+            for (int i = 0; i < 3; ++i) {
+                const double d = ap[i] - u * ab[i];
+                d2 += d * d;
+            }
+            return std::sqrt(d2);
+        }
+
+        // 点到参考路径的距离：在最近点两侧的线段上取最小值
+        double PathDist(SeamPathStore& path, const Point3d& p)
+        {
+            const size_t idx = path.NearestIndex(p);
+            if (path.Size() == 1) {
+                return SegmentDist(p, path[0], path[0]);
+            }
+            double dist = HUGE_VAL;
+            if (idx > 0) {
+                dist = SegmentDist(p, path[idx - 1], path[idx]);
+            }
+            if (idx + 1 < path.Size()) {
+                dist = std::min(dist, SegmentDist(p, path[idx], path[idx + 1]));
+            }
+            return dist;
+        }
+    }
+
+    TrackSimulator::TrackSimulator(const SimConfig& config)
+        : config_(config), converter_(std::make_unique<LaserCoordToTcp>())
+    {
+        if (config.framePeriod <= 0 || config.commPeriod <= 0) {
+            throw std::invalid_argument("period must be bigger than 0");
+        }
+        if (config.weldSpeed <= 0) {
+            throw std::invalid_argument("Speed must be bigger than 0");
+        }
+        if (config.queueCapacity == 0 || config.queueCapacity > QueueMaxCapacity) {
+            throw std::invalid_argument("queue capacity out of range");
+        }
+        if (config.sendBatch == 0 || config.sendBatch > config.queueCapacity) {
+            throw std::invalid_argument("send batch out of range");
+        }
+        if (config.startQueue > config.queueCapacity) {
+            throw std::invalid_argument("start queue out of range");
+        }
+        if (config.hampelWindow != 0 && (config.hampelWindow < 3 || config.hampelSigma <= 0)) {
+            throw std::invalid_argument("Hampel parameters out of range");
+        }
+    }
+
+    TrackSimulator::~TrackSimulator() = default;
+
+    SimResult TrackSimulator::Run(const SimRecording& recording)
+    {
+        SeamPosFilter filter(config_.MNoiseCov, config_.PNoiseCov);
+        return Run(recording, filter);
+    }
+
+    SimResult TrackSimulator::RunImpl(const SimRecording& recording, const PointFilter& filter)
+    {
+        status_ = TrackStatus::Sim_Start;
+        const auto wallStart = std::chrono::steady_clock::now();
+
+        std::optional<HampelFilter> hampel;
+        if (config_.hampelWindow > 0) {
+            hampel.emplace(config_.hampelWindow, config_.hampelSigma);
+        }
+        TrackInterpolator interp(recording.totalLen, recording.totalIncAtt);
+        interp.SetSpeedProfile(SpeedProfile(config_.weldSpeed));
+
+        // 参考路径：优先使用焊缝真值，否则使用未滤波的测量点
+        SeamPathStore ref;
+        const bool measuredRef = recording.refPath.empty();
+        for (const auto& pt : recording.refPath) {
+            ref.AppendPoint(pt);
+        }
+
+        std::vector<IncPt> pending;  // 已生成、尚未下发的增量
+        size_t sent = 0;
+        queue_.Clear();
+
+        // 焊枪位置以增量单位 (mm/0.001) 精确累加
+        Point3d torchStart = {};
+        long long torchAcc[3] = {};
+        bool hasTorch = false;
+        bool started = false;
+
+        SimResult result;
+        double errSum2 = 0.0;
+        size_t errNum = 0;
+        size_t nextFrame = 0;
+        double nextComm = 0.0;
+        const size_t frameNum = recording.frames.size();
+
+        status_ = TrackStatus::Sim_Run;
+        for (size_t k = 0;; ++k) {
+            const double t = k * MacroDefine::InterCycle;
+
+            // 1. 相机帧：像素 -> 基坐标系 -> 滤波 -> 插补
+            while (nextFrame < frameNum && nextFrame * config_.framePeriod <= t + TimeEps) {
+                const SimFrame& frame = recording.frames[nextFrame++];
+                std::vector<double> meaPt = converter_->Cal_LaserMeaPtToBase(frame.r, frame.c, frame.FLPPoint);
+                if (measuredRef) {
+                    ref.AppendPoint({ meaPt[0], meaPt[1], meaPt[2] });
+                }
+                // 飞溅、弧光反射造成的离群点在卡尔曼滤波之前以窗口中位数替换
+                std::vector<double> filterPt = filter(hampel ? hampel->Update(meaPt) : meaPt);
+                if (!hasTorch) {
+                    torchStart = { filterPt[0], filterPt[1], filterPt[2] };
+                    hasTorch = true;
+                }
+                interp.PushPoint(filterPt, pending);
+            }
+
+            // 2. 通讯：队列余量足够时成批下发
+            if (t + TimeEps >= nextComm) {
+                nextComm += config_.commPeriod;
+                if (queue_.Size() + config_.sendBatch <= config_.queueCapacity) {
+                    const size_t num = std::min(config_.sendBatch, pending.size() - sent);
+                    for (size_t i = 0; i < num; ++i) {
+                        queue_.Push(pending[sent++]);
+                    }
+                }
+                if (sent == pending.size()) {
+                    pending.clear();
+                    sent = 0;
+                }
+            }
+            result.maxQueue = std::max(result.maxQueue, queue_.Size());
+
+            const bool inputDone = (nextFrame >= frameNum) && (sent == pending.size());
+
+            // 3. 控制器：队列积累到 startQueue、无法再接收一批或输入结束后开始，每个插补周期执行一个增量
+            if (!started && (queue_.Size() >= config_.startQueue
+                || queue_.Size() + config_.sendBatch > config_.queueCapacity || inputDone)) {
+                started = true;
+            }
+            if (started && !queue_.Empty()) {
+                const IncPt& inc = queue_[0];
+                double step2 = 0.0;
+                for (int i = 0; i < 3; ++i) {
+                    torchAcc[i] += inc.d[i];
+                    step2 += static_cast<double>(inc.d[i]) * inc.d[i];
+                }
+                queue_.PopFront();
+                ++result.incCount;
+                result.pathLength += std::sqrt(step2) / 1000.0;
+
+                if (!ref.Empty()) {
+                    const Point3d torch = {
+                        torchStart[0] + torchAcc[0] / 1000.0,
+                        torchStart[1] + torchAcc[1] / 1000.0,
+                        torchStart[2] + torchAcc[2] / 1000.0 };
+                    const double err = PathDist(ref, torch);
+                    result.maxErr = std::max(result.maxErr, err);
+                    errSum2 += err * err;
+                    ++errNum;
+                }
+            }
+            else if (started && !inputDone) {
+                ++result.underruns;
+            }
+
+            if (inputDone && queue_.Empty()) {
+                result.simTime = (k + 1) * MacroDefine::InterCycle;
+                break;
+            }
+        }
+
+        result.frames = frameNum;
+        result.rejected = hampel ? hampel->GetStats().rejected : 0;
+        result.rmsErr = errNum ? std::sqrt(errSum2 / errNum) : 0.0;
+        result.wallTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+        status_ = TrackStatus::Track_null;
+        return result;
+    }
+
+    std::vector<SimResult> TrackSimulator::RunBatch(const std::vector<SimRecording>& recordings,
+        const SimConfig& config, WorkStealingPool& pool)
+    {
+        std::vector<SimResult> results(recordings.size());
+        pool.ParallelFor(0, recordings.size(), 1, [&](size_t begin, size_t end) {
+            TrackSimulator sim(config);
+            for (size_t i = begin; i < end; ++i) {
+                results[i] = sim.Run(recordings[i]);
+            }
+        });
+        return results;
+    }
+
+} // namespace WeldTrackApp
@@ -0,0 +1,158 @@
+#include "TxtMethod/AsyncLogWriter.h"
+#include "TxtMethod/TxtMethod.h"
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+// 后台线程单次取出的最大记录数
+static constexpr size_t BatchMax = 1024;
+
+AsyncLogWriter::AsyncLogWriter(const std::string& FileName, size_t capacity,
+    OverflowPolicy policy, int idleWaitMs)
+    : policy_(policy), idleWait_(std::max(1, idleWaitMs)) {
+    if (capacity < 2) {
+        throw std::invalid_argument("log queue capacity must be at least 2");
+    }
+    size_t size = 2;
+    while (size < capacity) {
+        size <<= 1;
+    }
+    mask_ = size - 1;
+    slots_.reset(new Slot[size]);
+    for (size_t i = 0; i < size; ++i) {
+        slots_[i].seq.store(i, std::memory_order_relaxed);
+    }
+
+    file_.open(FileName, std::ios::binary | std::ios::trunc);
+    if (!file_.is_open()) {
+        throw std::runtime_error("Error creating file: " + FileName);
+    }
+    worker_ = std::thread(&AsyncLogWriter::WorkerLoop, this);
+}
+
+AsyncLogWriter::~AsyncLogWriter() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    cv_.notify_one();
+    if (worker_.joinable()) {
+        worker_.join();
+    }
+}
+
+// 槽位序号等于位置时可写，等于位置 + 1 时可读
+bool AsyncLogWriter::TryPush(const double* values, size_t count) {
+    size_t pos = tail_.load(std::memory_order_relaxed);
+    while (true) {
+        Slot& slot = slots_[pos & mask_];
+        const size_t seq = slot.seq.load(std::memory_order_acquire);
+        const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+        if (diff == 0) {
+            if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                slot.rec.count = static_cast<uint32_t>(std::min(count, LogRecord::MaxCols));
+                std::memcpy(slot.rec.values, values, slot.rec.count * sizeof(double));
+                slot.seq.store(pos + 1, std::memory_order_release);
+                return true;
+            }
+        }
+        else if (diff < 0) {
+            return false;  // 队列已满
+        }
+        else {
+            pos = tail_.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+bool AsyncLogWriter::TryPop(LogRecord& rec) {
+    size_t pos = head_.load(std::memory_order_relaxed);
+    while (true) {
+        Slot& slot = slots_[pos & mask_];
+        const size_t seq = slot.seq.load(std::memory_order_acquire);
+        const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+        if (diff == 0) {
+            if (head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                rec = slot.rec;
+                slot.seq.store(pos + mask_ + 1, std::memory_order_release);
+                return true;
+            }
+        }
+        else if (diff < 0) {
+            return false;  // 队列为空或记录尚未写完
+        }
+        else {
+            pos = head_.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+bool AsyncLogWriter::Log(const double* values, size_t count) {
+    if (TryPush(values, count)) {
+        return true;
+    }
+    switch (policy_) {
+    case OverflowPolicy::Block:
+        while (!TryPush(values, count)) {
+            cv_.notify_one();
+            std::this_thread::yield();
+        }
+        return true;
+    case OverflowPolicy::DropOldest:
+        while (!TryPush(values, count)) {
+            LogRecord oldest;
+            if (TryPop(oldest)) {
+                dropped_.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+        return true;
+    default:
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+}
+
+void AsyncLogWriter::Flush() {
+    const size_t target = tail_.load(std::memory_order_acquire);
+    std::unique_lock<std::mutex> lock(mutex_);
+    flushReq_ = true;
+    cv_.notify_one();
+    doneCv_.wait(lock, [&]() { return donePos_ >= target || stop_; });
+}
+
+void AsyncLogWriter::WorkerLoop() {
+    std::string buffer;
+    LogRecord rec;
+    while (true) {
+        size_t num = 0;
+        while (num < BatchMax && TryPop(rec)) {
+            TxtMethod::AppendTxtLine(buffer, rec.values, rec.count);
+            ++num;
+        }
+        if (num > 0) {
+            file_.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+            buffer.clear();
+            written_.fetch_add(num, std::memory_order_relaxed);
+        }
+        if (num == BatchMax) {
+            continue;  // 队列中可能还有记录
+        }
+
+        // 队列已取空：落盘并通知等待中的 Flush
+        file_.flush();
+        std::unique_lock<std::mutex> lock(mutex_);
+        donePos_ = head_.load(std::memory_order_acquire);
+        doneCv_.notify_all();
+        if (stop_) {
+            if (donePos_ == tail_.load(std::memory_order_acquire)) {
+                break;
+            }
+            continue;
+        }
+        if (!flushReq_) {
+            cv_.wait_for(lock, idleWait_);
+        }
+        flushReq_ = false;
+    }
+    file_.close();
+}
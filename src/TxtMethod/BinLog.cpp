@@ -0,0 +1,366 @@
+#include "TxtMethod/BinLog.h"
+#include "TxtMethod/VarintCodec.h"
+#include <cstring>
+#include <cmath>
+#include <algorithm>
+#include <stdexcept>
+
+namespace {
+    constexpr size_t FixedHeaderBytesV1 = 32;
+    constexpr size_t FixedHeaderBytes = 40;
+
+    // 辅助函数：数据按小端存放，仅支持小端主机
+    bool IsLittleEndian() {
+        const uint16_t probe = 1;
+        unsigned char byte;
+        std::memcpy(&byte, &probe, 1);
+        return byte == 1;
+    }
+
+    size_t ElemSize(ColumnType type) {
+        return (type == ColumnType::Float64) ? sizeof(double) : sizeof(int32_t);
+    }
+
+    size_t Pad8(size_t bytes) {
+        return (bytes + 7) & ~static_cast<size_t>(7);
+    }
+
+    int DeltaOrder(ColumnCodec codec) {
+        return (codec == ColumnCodec::Delta2) ? 2 : 1;
+    }
+
+    template <typename T>
+    void Put(std::vector<char>& buf, size_t offset, T value) {
+        std::memcpy(buf.data() + offset, &value, sizeof(T));
+    }
+
+    template <typename T>
+    T Get(const char* data, size_t offset) {
+        T value;
+        std::memcpy(&value, data + offset, sizeof(T));
+        return value;
+    }
+}
+
+uint64_t BinLog::HashCalibration(const std::vector<double>& params) {
+    uint64_t hash = 14695981039346656037ull;
+    for (double value : params) {
+        unsigned char bytes[sizeof(double)];
+        std::memcpy(bytes, &value, sizeof(double));
+        for (unsigned char b : bytes) {
+            hash ^= b;
+            hash *= 1099511628211ull;
+        }
+    }
+    return hash;
+}
+
+BinLogWriter::BinLogWriter(const std::string& FileName, const ColumnSchema& schema,
+    uint64_t calibHash, uint32_t chunkRows)
+    : schema_(schema), chunkRows_(chunkRows), chunkCols_(schema.Size()) {
+    if (!IsLittleEndian()) {
+        throw std::runtime_error("binary log requires a little-endian host");
+    }
+    if (schema.Size() == 0 || schema.Size() > UINT16_MAX) {
+        throw std::invalid_argument("column count out of range");
+    }
+    if (chunkRows == 0) {
+        throw std::invalid_argument("chunk rows must be bigger than 0");
+    }
+    for (size_t i = 0; i < schema.Size(); ++i) {
+        if (schema[i].codec != ColumnCodec::Raw && schema[i].type != ColumnType::Int32) {
+            throw std::invalid_argument("only int32 columns can be delta encoded: " + schema[i].name);
+        }
+    }
+
+    // 文件头：总行数与索引位置在 Close 时回填
+    std::vector<char> header(FixedHeaderBytes);
+    std::memcpy(header.data(), BinLog::Magic, 4);
+    Put<uint16_t>(header, 4, BinLog::Version);
+    Put<uint16_t>(header, 6, static_cast<uint16_t>(schema.Size()));
+    Put<uint32_t>(header, 8, chunkRows);
+    Put<uint64_t>(header, 16, 0);
+    Put<uint64_t>(header, 24, calibHash);
+    Put<uint64_t>(header, 32, 0);
+    for (size_t i = 0; i < schema.Size(); ++i) {
+        const std::string& name = schema[i].name;
+        if (name.size() > UINT8_MAX) {
+            throw std::invalid_argument("column name too long: " + name);
+        }
+        header.push_back(static_cast<char>(schema[i].type == ColumnType::Float64 ? 0 : 1));
+        header.push_back(static_cast<char>(schema[i].codec));
+        header.push_back(static_cast<char>(name.size()));
+        header.insert(header.end(), name.begin(), name.end());
+    }
+    header.resize(Pad8(header.size()), 0);
+    Put<uint32_t>(header, 12, static_cast<uint32_t>(header.size()));
+
+    file_.open(FileName, std::ios::binary | std::ios::trunc);
+    if (!file_.is_open()) {
+        throw std::runtime_error("Error creating file: " + FileName);
+    }
+    file_.write(header.data(), static_cast<std::streamsize>(header.size()));
+    offset_ = header.size();
+
+    for (size_t i = 0; i < schema.Size(); ++i) {
+        chunkCols_[i].resize(static_cast<size_t>(chunkRows) * ElemSize(schema[i].type));
+    }
+}
+
+BinLogWriter::~BinLogWriter() {
+    try {
+        Close();
+    }
+    catch (...) {
+    }
+}
+
+void BinLogWriter::AppendRow(const std::vector<double>& row) {
+    if (closed_) {
+        throw std::logic_error("binary log already closed");
+    }
+    if (row.size() != schema_.Size()) {
+        throw std::invalid_argument("row size must equal column count");
+    }
+    for (size_t i = 0; i < row.size(); ++i) {
+        if (schema_[i].type == ColumnType::Float64) {
+            std::memcpy(chunkCols_[i].data() + chunkFill_ * sizeof(double), &row[i], sizeof(double));
+        }
+        else {
+            const int32_t value = static_cast<int32_t>(std::lround(row[i]));
+            std::memcpy(chunkCols_[i].data() + chunkFill_ * sizeof(int32_t), &value, sizeof(int32_t));
+        }
+    }
+    ++rows_;
+    if (++chunkFill_ == chunkRows_) {
+        FlushChunk();
+    }
+}
+
+void BinLogWriter::Append(const ColumnTable& table) {
+    if (closed_) {
+        throw std::logic_error("binary log already closed");
+    }
+    const ColumnSchema& schema = table.Schema();
+    if (schema.Size() != schema_.Size()) {
+        throw std::invalid_argument("column count mismatch");
+    }
+    for (size_t i = 0; i < schema.Size(); ++i) {
+        if (schema[i].type != schema_[i].type) {
+            throw std::invalid_argument("column type mismatch: " + schema[i].name);
+        }
+    }
+
+    // 按块整段拷贝各列
+    size_t done = 0;
+    while (done < table.Rows()) {
+        const size_t num = std::min<size_t>(table.Rows() - done, chunkRows_ - chunkFill_);
+        for (size_t i = 0; i < schema.Size(); ++i) {
+            const size_t elem = ElemSize(schema[i].type);
+            const char* src = (schema[i].type == ColumnType::Float64)
+                ? reinterpret_cast<const char*>(table.Float64(i).data())
+                : reinterpret_cast<const char*>(table.Int32(i).data());
+            std::memcpy(chunkCols_[i].data() + chunkFill_ * elem, src + done * elem, num * elem);
+        }
+        done += num;
+        rows_ += num;
+        chunkFill_ += static_cast<uint32_t>(num);
+        if (chunkFill_ == chunkRows_) {
+            FlushChunk();
+        }
+    }
+}
+
+void BinLogWriter::FlushChunk() {
+    static const char zeros[8] = {};
+    for (size_t i = 0; i < chunkCols_.size(); ++i) {
+        const char* src = chunkCols_[i].data();
+        size_t bytes = chunkFill_ * ElemSize(schema_[i].type);
+        if (schema_[i].codec != ColumnCodec::Raw) {
+            encoded_.clear();
+            VarintCodec::Encode(reinterpret_cast<const int32_t*>(src), chunkFill_, DeltaOrder(schema_[i].codec), encoded_);
+            src = encoded_.data();
+            bytes = encoded_.size();
+        }
+        index_.push_back(offset_);
+        file_.write(src, static_cast<std::streamsize>(bytes));
+        file_.write(zeros, static_cast<std::streamsize>(Pad8(bytes) - bytes));
+        offset_ += Pad8(bytes);
+    }
+    chunkFill_ = 0;
+}
+
+void BinLogWriter::Close() {
+    if (closed_) {
+        return;
+    }
+    closed_ = true;
+    if (chunkFill_ > 0) {
+        FlushChunk();
+    }
+    index_.push_back(offset_);
+    const uint64_t indexOffset = offset_;
+    file_.write(reinterpret_cast<const char*>(index_.data()), static_cast<std::streamsize>(index_.size() * sizeof(uint64_t)));
+    file_.seekp(16);
+    file_.write(reinterpret_cast<const char*>(&rows_), sizeof(rows_));
+    file_.seekp(32);
+    file_.write(reinterpret_cast<const char*>(&indexOffset), sizeof(indexOffset));
+    file_.close();
+    if (file_.fail()) {
+        throw std::runtime_error("Error writing binary log");
+    }
+}
+
+BinLogReader::BinLogReader(const std::string& FileName)
+    : file_(FileName) {
+    if (!IsLittleEndian()) {
+        throw std::runtime_error("binary log requires a little-endian host");
+    }
+    const char* data = file_.Data();
+    const size_t size = file_.Size();
+    if (size < FixedHeaderBytesV1 || std::memcmp(data, BinLog::Magic, 4) != 0) {
+        throw std::runtime_error("not a binary track log: " + FileName);
+    }
+    version_ = Get<uint16_t>(data, 4);
+    if (version_ == 0 || version_ > BinLog::Version) {
+        throw std::runtime_error("unsupported binary log version " + std::to_string(version_));
+    }
+    const size_t fixedBytes = (version_ >= 2) ? FixedHeaderBytes : FixedHeaderBytesV1;
+    const uint16_t colNum = Get<uint16_t>(data, 6);
+    chunkRows_ = Get<uint32_t>(data, 8);
+    const uint32_t headerBytes = Get<uint32_t>(data, 12);
+    rows_ = Get<uint64_t>(data, 16);
+    calibHash_ = Get<uint64_t>(data, 24);
+    if (colNum == 0 || chunkRows_ == 0 || headerBytes < fixedBytes || headerBytes > size || headerBytes % 8 != 0) {
+        throw std::runtime_error("corrupt binary log header: " + FileName);
+    }
+
+    // 列描述：版本 1 没有编码字节
+    const size_t descBytes = (version_ >= 2) ? 3 : 2;
+    size_t pos = fixedBytes;
+    for (uint16_t i = 0; i < colNum; ++i) {
+        if (pos + descBytes > headerBytes) {
+            throw std::runtime_error("corrupt binary log header: " + FileName);
+        }
+        const unsigned char type = static_cast<unsigned char>(data[pos]);
+        const unsigned char codec = (version_ >= 2) ? static_cast<unsigned char>(data[pos + 1]) : 0;
+        const size_t nameLen = static_cast<unsigned char>(data[pos + descBytes - 1]);
+        pos += descBytes;
+        if (type > 1 || codec > static_cast<unsigned char>(ColumnCodec::Delta2) || (codec != 0 && type == 0)
+            || pos + nameLen > headerBytes) {
+            throw std::runtime_error("corrupt binary log header: " + FileName);
+        }
+        schema_.Add(std::string(data + pos, nameLen), type == 0 ? ColumnType::Float64 : ColumnType::Int32,
+            static_cast<ColumnCodec>(codec));
+        pos += nameLen;
+    }
+
+    // 各块各列的起始位置：版本 1 由块大小推算，版本 2 读取文件尾的索引
+    if (ChunkCount() > size / 8) {
+        throw std::runtime_error("truncated binary log: " + FileName);
+    }
+    const size_t blockNum = ChunkCount() * schema_.Size();
+    if (version_ == 1) {
+        uint64_t offset = headerBytes;
+        blocks_.reserve(blockNum + 1);
+        for (size_t chunk = 0; chunk < ChunkCount(); ++chunk) {
+            const uint64_t rows = std::min<uint64_t>(chunkRows_, rows_ - static_cast<uint64_t>(chunk) * chunkRows_);
+            for (size_t i = 0; i < schema_.Size(); ++i) {
+                blocks_.push_back(offset);
+                offset += Pad8(static_cast<size_t>(rows) * ElemSize(schema_[i].type));
+            }
+        }
+        blocks_.push_back(offset);
+        if (offset > size) {
+            throw std::runtime_error("truncated binary log: " + FileName);
+        }
+    }
+    else {
+        const uint64_t indexOffset = Get<uint64_t>(data, 32);
+        if (indexOffset < headerBytes || indexOffset % 8 != 0 || indexOffset > size
+            || (size - indexOffset) / sizeof(uint64_t) < blockNum + 1) {
+            throw std::runtime_error("truncated binary log: " + FileName);
+        }
+        blocks_.resize(blockNum + 1);
+        std::memcpy(blocks_.data(), data + indexOffset, blocks_.size() * sizeof(uint64_t));
+        if (blocks_.front() < headerBytes || blocks_.back() > indexOffset) {
+            throw std::runtime_error("corrupt binary log index: " + FileName);
+        }
+        for (size_t b = 0; b < blockNum; ++b) {
+            const size_t col = b % schema_.Size();
+            const uint64_t rows = std::min<uint64_t>(chunkRows_, rows_ - static_cast<uint64_t>(b / schema_.Size()) * chunkRows_);
+            const uint64_t minBytes = (schema_[col].codec == ColumnCodec::Raw) ? rows * ElemSize(schema_[col].type) : 0;
+            if (blocks_[b] % 8 != 0 || blocks_[b + 1] < blocks_[b] || blocks_[b + 1] - blocks_[b] < minBytes) {
+                throw std::runtime_error("corrupt binary log index: " + FileName);
+            }
+        }
+    }
+    cache_.resize(schema_.Size());
+    cacheChunk_.assign(schema_.Size(), SIZE_MAX);
+}
+
+const char* BinLogReader::ColumnData(size_t col, size_t chunk, ColumnType type, size_t& rows) const {
+    if (col >= schema_.Size() || chunk >= ChunkCount()) {
+        throw std::out_of_range("binary log index out of range");
+    }
+    if (schema_[col].type != type) {
+        throw std::invalid_argument("column type mismatch: " + schema_[col].name);
+    }
+    rows = static_cast<size_t>(std::min<uint64_t>(chunkRows_, rows_ - static_cast<uint64_t>(chunk) * chunkRows_));
+    const size_t block = chunk * schema_.Size() + col;
+    const char* base = file_.Data() + blocks_[block];
+    if (schema_[col].codec == ColumnCodec::Raw) {
+        return base;
+    }
+
+    if (cacheChunk_[col] != chunk) {
+        cacheChunk_[col] = SIZE_MAX;  // 解码失败时缓存作废
+        cache_[col].resize(rows);
+        VarintCodec::Decode(base, static_cast<size_t>(blocks_[block + 1] - blocks_[block]),
+            DeltaOrder(schema_[col].codec), cache_[col].data(), rows);
+        cacheChunk_[col] = chunk;
+    }
+    return reinterpret_cast<const char*>(cache_[col].data());
+}
+
+const double* BinLogReader::Float64Chunk(size_t col, size_t chunk, size_t& rows) const {
+    return reinterpret_cast<const double*>(ColumnData(col, chunk, ColumnType::Float64, rows));
+}
+
+const int32_t* BinLogReader::Int32Chunk(size_t col, size_t chunk, size_t& rows) const {
+    return reinterpret_cast<const int32_t*>(ColumnData(col, chunk, ColumnType::Int32, rows));
+}
+
+double BinLogReader::Value(uint64_t row, size_t col) const {
+    if (row >= rows_ || col >= schema_.Size()) {
+        throw std::out_of_range("binary log index out of range");
+    }
+    const size_t chunk = static_cast<size_t>(row / chunkRows_);
+    const size_t idx = static_cast<size_t>(row % chunkRows_);
+    size_t rows = 0;
+    const char* base = ColumnData(col, chunk, schema_[col].type, rows);
+    if (schema_[col].type == ColumnType::Float64) {
+        return Get<double>(base, idx * sizeof(double));
+    }
+    return Get<int32_t>(base, idx * sizeof(int32_t));
+}
+
+ColumnTable BinLogReader::ReadAll() const {
+    ColumnTable table(schema_);
+    table.Reserve(static_cast<size_t>(rows_));
+    for (size_t chunk = 0; chunk < ChunkCount(); ++chunk) {
+        size_t rows = 0;
+        for (size_t i = 0; i < schema_.Size(); ++i) {
+            if (schema_[i].type == ColumnType::Float64) {
+                const double* src = Float64Chunk(i, chunk, rows);
+                table.cols_[i].f64.insert(table.cols_[i].f64.end(), src, src + rows);
+            }
+            else {
+                const int32_t* src = Int32Chunk(i, chunk, rows);
+                table.cols_[i].i32.insert(table.cols_[i].i32.end(), src, src + rows);
+            }
+        }
+    }
+    table.rows_ = static_cast<size_t>(rows_);
+    return table;
+}
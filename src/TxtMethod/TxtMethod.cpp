@@ -1,67 +1,750 @@
 #include "TxtMethod/TxtMethod.h"
-#include <sstream>
-#include <iomanip>
+#include "TxtMethod/BinLog.h"
+#include "MappedFile.h"
+#include "WorkStealingPool.h"
 #include <iostream>
+#include <charconv>
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+#include <stdexcept>
 
-// ʽdoubleֵΪ"0000.00"ʽ
-static std::string FormatDouble(double value) {
-    std::ostringstream oss;
-    oss << std::fixed << std::setprecision(2)
-        << std::setw(7) << std::setfill('0') << value;
-    return oss.str();
+// 写出缓冲区达到此大小时写入文件
+static constexpr size_t WriteBufSize = 1 << 20;
+
+// 读取缓冲区大小
+static constexpr size_t ReadBufSize = 1 << 20;
+
+// 辅助函数：空白字符判定（与 C locale 下的 std::isspace 相同）
+static inline bool IsSpace(char ch) {
+    return ch == ' ' || ch == '\t' || ch == '\n' || ch == '\v' || ch == '\f' || ch == '\r';
 }
 
-std::vector<std::vector<double>> TxtMethod::ReadData(const std::string& FileName) {
-    std::vector<std::vector<double>> result;
-    std::ifstream file(FileName);
+// 辅助函数：解析一个数值字段，结果与 std::stod 完全一致
+// 常规字段由 std::from_chars 一次解析完成；带 '+' 号、十六进制、部分可解析、下溢等少见情况交给 std::stod
+static bool ParseDouble(const char* first, const char* last, double& value) {
+    auto res = std::from_chars(first, last, value);
+    if (res.ec == std::errc() && res.ptr == last) {
+        if (value != 0.0) {
+            // 非规格化数：std::stod 报 out_of_range
+            if (std::fabs(value) >= DBL_MIN || std::isinf(value) || std::isnan(value)) {
+                return true;
+            }
+        }
+        else {
+            // 尾数含非零数字的 0 为下溢结果
+            bool underflow = false;
+            for (const char* p = first; p != last && *p != 'e' && *p != 'E'; ++p) {
+                if (*p >= '1' && *p <= '9') {
+                    underflow = true;
+                    break;
+                }
+            }
+            if (!underflow) {
+                return true;
+            }
+        }
+    }
+
+    try {
+        value = std::stod(std::string(first, last));
+        return true;
+    }
+    catch (...) {
+        return false;
+    }
+}
+
+// 辅助函数：解析 int32 字段，须为完整的十进制整数
+static bool ParseInt32(const char* first, const char* last, int32_t& value) {
+    auto res = std::from_chars(first, last, value);
+    return res.ec == std::errc() && res.ptr == last;
+}
+
+// 辅助函数：取下一个以空白分隔的字段
+static inline bool NextToken(const char*& p, const char* last, const char*& tokenBegin) {
+    while (p != last && IsSpace(*p)) {
+        ++p;
+    }
+    if (p == last) {
+        return false;
+    }
+    tokenBegin = p;
+    while (p != last && !IsSpace(*p)) {
+        ++p;
+    }
+    return true;
+}
+
+// 辅助函数：解析 [first, last) 内的一行，前3个字段均有效时追加到结果
+static void ParseLine(const char* first, const char* last, std::vector<std::vector<double>>& result) {
+    double values[3];
+    const char* p = first;
+    const char* tokenBegin = nullptr;
+    for (size_t count = 0; count < 3; ++count) {
+        if (!NextToken(p, last, tokenBegin)) {
+            return;  // 不足3个字段
+        }
+        if (!ParseDouble(tokenBegin, p, values[count])) {
+            return;  // 转换失败时跳过当前行
+        }
+    }
+    result.push_back({ values[0], values[1], values[2] });
+}
 
+// 辅助函数：整块读入缓冲区后逐行回调，行尾不完整的部分移到缓冲区头部与下一块拼接
+// onFirstBlock(lineNum, blockBytes, fileSize) 在第一块读入后调用一次，用于预估总行数；onLine 返回 false 时停止读取
+template <typename FirstBlockFn, typename LineFn>
+static bool ForEachLine(const std::string& FileName, FirstBlockFn&& onFirstBlock, LineFn&& onLine) {
+    std::ifstream file(FileName, std::ios::binary);
     if (!file.is_open()) {
         std::cerr << "Error opening file: " << FileName << std::endl;
-        return result;
+        return false;
     }
 
-    std::string line;
-    while (std::getline(file, line)) {
-        std::istringstream iss(line);
-        std::vector<double> values;
-        std::string token;
+    file.seekg(0, std::ios::end);
+    const auto fileSize = static_cast<size_t>(file.tellg());
+    file.seekg(0, std::ios::beg);
 
-        // ȡ3ֵ
-        while (iss >> token && values.size() < 3) {
-            try {
-                values.push_back(std::stod(token));
+    std::vector<char> buffer(ReadBufSize);
+    size_t used = 0;
+    bool first = true;
+    while (true) {
+        if (used == buffer.size()) {
+            buffer.resize(buffer.size() * 2);  // 单行超过缓冲区
+        }
+        file.read(buffer.data() + used, static_cast<std::streamsize>(buffer.size() - used));
+        const size_t got = static_cast<size_t>(file.gcount());
+        if (got == 0) {
+            break;
+        }
+        used += got;
+
+        const char* data = buffer.data();
+        const char* end = data + used;
+        const char* lineBegin = data;
+        if (first) {
+            first = false;
+            onFirstBlock(static_cast<size_t>(std::count(data, end, '\n')), used, fileSize);
+        }
+        while (const char* lineEnd = static_cast<const char*>(std::memchr(lineBegin, '\n', static_cast<size_t>(end - lineBegin)))) {
+            if (!onLine(lineBegin, lineEnd)) {
+                return true;
             }
-            catch (...) {
-                // תʧʱǰ
-                values.clear();
-                break;
+            lineBegin = lineEnd + 1;
+        }
+        used = static_cast<size_t>(end - lineBegin);
+        std::memmove(buffer.data(), lineBegin, used);
+    }
+
+    // 最后一行没有换行符
+    if (used > 0) {
+        onLine(buffer.data(), buffer.data() + used);
+    }
+    return true;
+}
+
+// 辅助函数：按第一块的平均行长预估总行数
+static size_t EstimateLines(size_t lineNum, size_t blockBytes, size_t fileSize) {
+    if (lineNum == 0 || blockBytes == 0 || fileSize <= blockBytes) {
+        return lineNum;
+    }
+    return lineNum + lineNum * (fileSize - blockBytes) / blockBytes;
+}
+
+std::vector<std::vector<double>> TxtMethod::ReadData(const std::string& FileName) {
+    std::vector<std::vector<double>> result;
+    ForEachLine(FileName,
+        [&](size_t lineNum, size_t blockBytes, size_t fileSize) {
+            result.reserve(EstimateLines(lineNum, blockBytes, fileSize));
+        },
+        [&](const char* first, const char* last) {
+            ParseLine(first, last, result);
+            return true;
+        });
+    return result;
+}
+
+ColumnTable TxtMethod::ReadColumns(const std::string& FileName, const ColumnSchema& schema) {
+    ColumnTable table(schema);
+    ForEachLine(FileName,
+        [&](size_t lineNum, size_t blockBytes, size_t fileSize) {
+            table.Reserve(EstimateLines(lineNum, blockBytes, fileSize));
+        },
+        [&](const char* first, const char* last) {
+            table.AppendText(first, last);
+            return true;
+        });
+    return table;
+}
+
+// 并行读取的一段：第 file 个文件中 [first, last) 的完整行
+struct FileSegment {
+    size_t file;
+    const char* first;
+    const char* last;
+};
+
+// 辅助函数：映射各文件并在行边界处切分为约 segmentBytes 字节的段
+// 无法打开的文件输出错误信息，不产生段
+static std::vector<FileSegment> SplitFiles(const std::vector<std::string>& FileNames, size_t segmentBytes,
+    std::vector<WeldTrackApp::MappedFile>& files) {
+    segmentBytes = std::max<size_t>(1, segmentBytes);
+    files.clear();
+    files.resize(FileNames.size());
+    std::vector<FileSegment> segments;
+    for (size_t f = 0; f < FileNames.size(); ++f) {
+        try {
+            files[f].Open(FileNames[f]);
+        }
+        catch (const std::exception&) {
+            std::cerr << "Error opening file: " << FileNames[f] << std::endl;
+            continue;
+        }
+        const char* data = files[f].Data();
+        const char* end = data + files[f].Size();
+        const char* first = data;
+        while (first < end) {
+            const char* last = end;
+            if (static_cast<size_t>(end - first) > segmentBytes) {
+                // 段尾移到其后第一个换行符之后，保证每段只含完整的行
+                const char* cut = first + segmentBytes - 1;
+                const char* nl = static_cast<const char*>(std::memchr(cut, '\n', static_cast<size_t>(end - cut)));
+                last = (nl != nullptr) ? nl + 1 : end;
             }
+            segments.push_back({ f, first, last });
+            first = last;
         }
+    }
+    return segments;
+}
 
-        // ȷ3Чֵ
-        if (values.size() == 3) {
-            result.push_back(std::move(values));
+// 辅助函数：在线程池上并行解析各段，parts[i] 为第 i 段的结果
+// onLine(part, first, last) 处理一行，与 ForEachLine 的行划分相同（最后一行可无换行符）
+template <typename Part, typename LineFn>
+static std::vector<Part> ParseSegments(const std::vector<FileSegment>& segments, const Part& proto,
+    WeldTrackApp::WorkStealingPool& pool, LineFn&& onLine) {
+    std::vector<Part> parts(segments.size(), proto);
+    pool.ParallelFor(0, segments.size(), 1, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            const char* lineBegin = segments[i].first;
+            const char* last = segments[i].last;
+            while (lineBegin < last) {
+                const char* lineEnd = static_cast<const char*>(std::memchr(lineBegin, '\n', static_cast<size_t>(last - lineBegin)));
+                if (lineEnd == nullptr) {
+                    lineEnd = last;
+                }
+                onLine(parts[i], lineBegin, lineEnd);
+                lineBegin = lineEnd + 1;
+            }
+        }
+    });
+    return parts;
+}
+
+std::vector<std::vector<double>> TxtMethod::ReadDataParallel(const std::string& FileName,
+    WeldTrackApp::WorkStealingPool& pool, size_t segmentBytes) {
+    return std::move(ReadDataParallel(std::vector<std::string>{ FileName }, pool, segmentBytes).front());
+}
+
+std::vector<std::vector<std::vector<double>>> TxtMethod::ReadDataParallel(const std::vector<std::string>& FileNames,
+    WeldTrackApp::WorkStealingPool& pool, size_t segmentBytes) {
+    std::vector<WeldTrackApp::MappedFile> files;
+    const std::vector<FileSegment> segments = SplitFiles(FileNames, segmentBytes, files);
+    std::vector<std::vector<std::vector<double>>> parts = ParseSegments(segments, std::vector<std::vector<double>>(), pool,
+        [](std::vector<std::vector<double>>& part, const char* first, const char* last) {
+            ParseLine(first, last, part);
+        });
+
+    // 按段序拼接到各文件
+    std::vector<std::vector<std::vector<double>>> result(FileNames.size());
+    for (size_t i = 0; i < segments.size(); ++i) {
+        auto& rows = result[segments[i].file];
+        if (rows.empty()) {
+            rows = std::move(parts[i]);
+        }
+        else {
+            rows.insert(rows.end(), std::make_move_iterator(parts[i].begin()), std::make_move_iterator(parts[i].end()));
         }
     }
     return result;
 }
 
+ColumnTable TxtMethod::ReadColumnsParallel(const std::string& FileName, const ColumnSchema& schema,
+    WeldTrackApp::WorkStealingPool& pool, size_t segmentBytes) {
+    return std::move(ReadColumnsParallel(std::vector<std::string>{ FileName }, schema, pool, segmentBytes).front());
+}
+
+std::vector<ColumnTable> TxtMethod::ReadColumnsParallel(const std::vector<std::string>& FileNames,
+    const ColumnSchema& schema, WeldTrackApp::WorkStealingPool& pool, size_t segmentBytes) {
+    std::vector<WeldTrackApp::MappedFile> files;
+    const std::vector<FileSegment> segments = SplitFiles(FileNames, segmentBytes, files);
+    std::vector<ColumnTable> parts = ParseSegments(segments, ColumnTable(schema), pool,
+        [](ColumnTable& part, const char* first, const char* last) {
+            part.AppendText(first, last);
+        });
+
+    std::vector<ColumnTable> result(FileNames.size(), ColumnTable(schema));
+    for (size_t i = 0; i < segments.size(); ++i) {
+        ColumnTable& table = result[segments[i].file];
+        if (table.Rows() == 0) {
+            table = std::move(parts[i]);
+        }
+        else {
+            table.Append(parts[i]);
+        }
+    }
+    return result;
+}
+
+bool TxtMethod::ReadChunks(const std::string& FileName, const ColumnSchema& schema, size_t chunkRows,
+    const std::function<bool(const ColumnTable&)>& onChunk) {
+    if (chunkRows == 0) {
+        throw std::invalid_argument("chunkRows must be positive");
+    }
+    ColumnTable chunk(schema);
+    chunk.Reserve(chunkRows);
+    bool stopped = false;
+    const bool opened = ForEachLine(FileName,
+        [](size_t, size_t, size_t) {},
+        [&](const char* first, const char* last) {
+            if (chunk.AppendText(first, last) && chunk.Rows() == chunkRows) {
+                stopped = !onChunk(chunk);
+                chunk.Clear();  // 保留容量，后续块不再分配
+            }
+            return !stopped;
+        });
+    if (opened && !stopped && chunk.Rows() > 0) {
+        onChunk(chunk);
+    }
+    return opened;
+}
+
+ColumnSchema::ColumnSchema(std::initializer_list<ColumnSpec> cols)
+    : cols_(cols) {
+}
+
+ColumnSchema ColumnSchema::Doubles(size_t n, const std::string& prefix) {
+    ColumnSchema schema;
+    for (size_t i = 0; i < n; ++i) {
+        schema.Add(prefix + std::to_string(i));
+    }
+    return schema;
+}
+
+ColumnSchema ColumnSchema::Point3() {
+    return { { "x" }, { "y" }, { "z" } };
+}
+
+ColumnSchema ColumnSchema::Pose6() {
+    return { { "x" }, { "y" }, { "z" }, { "rx" }, { "ry" }, { "rz" } };
+}
+
+ColumnSchema ColumnSchema::TrackSave() {
+    ColumnSchema schema = Doubles(5);
+    schema.Add("x");
+    schema.Add("y");
+    schema.Add("z");
+    return schema;
+}
+
+ColumnSchema ColumnSchema::Int32s(size_t n, const std::string& prefix, ColumnCodec codec) {
+    ColumnSchema schema;
+    for (size_t i = 0; i < n; ++i) {
+        schema.Add(prefix + std::to_string(i), ColumnType::Int32, codec);
+    }
+    return schema;
+}
+
+ColumnSchema ColumnSchema::IncData(ColumnCodec codec) {
+    ColumnSchema schema;
+    for (const char* name : { "dx", "dy", "dz", "drx", "dry", "drz" }) {
+        schema.Add(name, ColumnType::Int32, codec);
+    }
+    return schema;
+}
+
+void ColumnSchema::Add(const std::string& name, ColumnType type, ColumnCodec codec) {
+    cols_.push_back({ name, type, codec });
+}
+
+int ColumnSchema::IndexOf(const std::string& name) const {
+    for (size_t i = 0; i < cols_.size(); ++i) {
+        if (cols_[i].name == name) {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+
+ColumnTable::ColumnTable(const ColumnSchema& schema)
+    : schema_(schema), cols_(schema.Size()) {
+}
+
+void ColumnTable::Reserve(size_t rows) {
+    for (size_t i = 0; i < cols_.size(); ++i) {
+        if (schema_[i].type == ColumnType::Float64) {
+            cols_[i].f64.reserve(rows);
+        }
+        else {
+            cols_[i].i32.reserve(rows);
+        }
+    }
+}
+
+void ColumnTable::Clear() {
+    for (auto& col : cols_) {
+        col.f64.clear();
+        col.i32.clear();
+    }
+    rows_ = 0;
+}
+
+size_t ColumnTable::CheckCol(size_t col, ColumnType type) const {
+    if (col >= cols_.size()) {
+        throw std::out_of_range("column index out of range");
+    }
+    if (schema_[col].type != type) {
+        throw std::invalid_argument("column type mismatch: " + schema_[col].name);
+    }
+    return col;
+}
+
+const std::vector<double>& ColumnTable::Float64(size_t col) const {
+    return cols_[CheckCol(col, ColumnType::Float64)].f64;
+}
+
+const std::vector<int32_t>& ColumnTable::Int32(size_t col) const {
+    return cols_[CheckCol(col, ColumnType::Int32)].i32;
+}
+
+const std::vector<double>& ColumnTable::Float64(const std::string& name) const {
+    const int col = schema_.IndexOf(name);
+    if (col < 0) {
+        throw std::out_of_range("no column named " + name);
+    }
+    return Float64(static_cast<size_t>(col));
+}
+
+const std::vector<int32_t>& ColumnTable::Int32(const std::string& name) const {
+    const int col = schema_.IndexOf(name);
+    if (col < 0) {
+        throw std::out_of_range("no column named " + name);
+    }
+    return Int32(static_cast<size_t>(col));
+}
+
+double ColumnTable::Value(size_t row, size_t col) const {
+    if (row >= rows_ || col >= cols_.size()) {
+        throw std::out_of_range("table index out of range");
+    }
+    return (schema_[col].type == ColumnType::Float64) ? cols_[col].f64[row] : cols_[col].i32[row];
+}
+
+void ColumnTable::AppendRow(const std::vector<double>& row) {
+    if (row.size() != cols_.size()) {
+        throw std::invalid_argument("row size must equal column count");
+    }
+    for (size_t i = 0; i < cols_.size(); ++i) {
+        if (schema_[i].type == ColumnType::Float64) {
+            cols_[i].f64.push_back(row[i]);
+        }
+        else {
+            cols_[i].i32.push_back(static_cast<int32_t>(std::lround(row[i])));
+        }
+    }
+    ++rows_;
+}
+
+void ColumnTable::Append(const ColumnTable& other) {
+    if (other.Cols() != Cols()) {
+        throw std::invalid_argument("column count mismatch");
+    }
+    for (size_t i = 0; i < cols_.size(); ++i) {
+        if (schema_[i].type != other.schema_[i].type) {
+            throw std::invalid_argument("column type mismatch: " + schema_[i].name);
+        }
+        if (schema_[i].type == ColumnType::Float64) {
+            cols_[i].f64.insert(cols_[i].f64.end(), other.cols_[i].f64.begin(), other.cols_[i].f64.end());
+        }
+        else {
+            cols_[i].i32.insert(cols_[i].i32.end(), other.cols_[i].i32.begin(), other.cols_[i].i32.end());
+        }
+    }
+    rows_ += other.rows_;
+}
+
+bool ColumnTable::AppendText(const char* first, const char* last) {
+    const char* p = first;
+    const char* tokenBegin = nullptr;
+    size_t col = 0;
+    for (; col < cols_.size(); ++col) {
+        if (!NextToken(p, last, tokenBegin)) {
+            break;
+        }
+        bool ok;
+        if (schema_[col].type == ColumnType::Float64) {
+            double value;
+            ok = ParseDouble(tokenBegin, p, value);
+            if (ok) {
+                cols_[col].f64.push_back(value);
+            }
+        }
+        else {
+            int32_t value;
+            ok = ParseInt32(tokenBegin, p, value);
+            if (ok) {
+                cols_[col].i32.push_back(value);
+            }
+        }
+        if (!ok) {
+            break;
+        }
+    }
+
+    // 字段不足或转换失败：撤销本行已写入的列
+    if (col < cols_.size() || cols_.empty()) {
+        for (size_t i = 0; i < col; ++i) {
+            if (schema_[i].type == ColumnType::Float64) {
+                cols_[i].f64.pop_back();
+            }
+            else {
+                cols_[i].i32.pop_back();
+            }
+        }
+        return false;
+    }
+    ++rows_;
+    return true;
+}
+
+std::vector<std::vector<double>> ColumnTable::ToRows() const {
+    std::vector<std::vector<double>> rows(rows_, std::vector<double>(cols_.size()));
+    for (size_t j = 0; j < cols_.size(); ++j) {
+        if (schema_[j].type == ColumnType::Float64) {
+            const double* src = cols_[j].f64.data();
+            for (size_t i = 0; i < rows_; ++i) {
+                rows[i][j] = src[i];
+            }
+        }
+        else {
+            const int32_t* src = cols_[j].i32.data();
+            for (size_t i = 0; i < rows_; ++i) {
+                rows[i][j] = src[i];
+            }
+        }
+    }
+    return rows;
+}
+
 void TxtMethod::WriteTxt(const std::vector<std::vector<double>>& ilv_LaserPoints,
-    const std::string& FileName) {
+    const std::string& FileName, int precision) {
+    CheckPrecision(precision);
     std::ofstream file(FileName);
     if (!file.is_open()) {
         std::cerr << "Error creating file: " << FileName << std::endl;
         return;
     }
 
+    std::string buffer;
+    buffer.reserve(WriteBufSize + 4096);
     for (const auto& point : ilv_LaserPoints) {
-        std::string line;
-        for (size_t j = 0; j < point.size(); ++j) {
-            line += FormatDouble(point[j]);
-            if (j < point.size() - 1) {
-                line += " ";
+        AppendTxtLine(buffer, point.data(), point.size(), precision);
+        if (buffer.size() >= WriteBufSize) {
+            file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+            buffer.clear();
+        }
+    }
+    file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+}
+
+void TxtMethod::CheckPrecision(int precision) {
+    if (precision < 0 || precision > MaxPrecision) {
+        throw std::invalid_argument("precision must be in [0, " + std::to_string(MaxPrecision) + "]");
+    }
+}
+
+// 快速路径适用的最大小数位数与放大后数值的上限
+static constexpr int FastPrecision = 9;
+static constexpr double FastLimit = 1e12;
+static constexpr uint64_t Pow10[FastPrecision + 1] = {
+    1ull, 10ull, 100ull, 1000ull, 10000ull, 100000ull, 1000000ull, 10000000ull, 100000000ull, 1000000000ull };
+
+// 辅助函数：常见数值的定点格式化，从 end 向前写出，返回起始位置；结果无法确定时返回 nullptr
+// value * 10^p 的乘法误差不超过 FastLimit 的半个 ulp（约 6e-5），小数部分远离 0.5 时四舍五入结果与精确值相同；
+// 接近 0.5 的情况（含二进制恰为 .5 的值）交给 std::to_chars 按精确值处理
+static char* FormatFixedFast(char* end, double value, int precision) {
+    if (precision > FastPrecision) {
+        return nullptr;
+    }
+    const double scaled = std::fabs(value) * static_cast<double>(Pow10[precision]);
+    if (!(scaled < FastLimit)) {
+        return nullptr;  // 大数、inf、nan
+    }
+    const double frac = scaled - std::floor(scaled);
+    if (std::fabs(frac - 0.5) < 1e-3) {
+        return nullptr;
+    }
+    // scaled < 2^40 时 scaled + 0.5 无舍入误差
+    const uint64_t n = static_cast<uint64_t>(scaled + 0.5);
+
+    // 每次写出两位
+    static const char Digits2[] =
+        "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+        "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+        "8081828384858687888990919293949596979899";
+    char* p = end;
+    uint64_t intPart = n;
+    if (precision > 0) {
+        intPart = n / Pow10[precision];
+        uint64_t fracPart = n - intPart * Pow10[precision];
+        int i = precision;
+        for (; i >= 2; i -= 2) {
+            p -= 2;
+            std::memcpy(p, Digits2 + (fracPart % 100) * 2, 2);
+            fracPart /= 100;
+        }
+        if (i == 1) {
+            *--p = static_cast<char>('0' + fracPart);
+        }
+        *--p = '.';
+    }
+    if (intPart < 10000) {
+        // 常见的 4 位以内整数：写满 4 位后去掉前导零，不依赖难以预测的分支
+        p -= 4;
+        std::memcpy(p, Digits2 + (intPart / 100) * 2, 2);
+        std::memcpy(p + 2, Digits2 + (intPart % 100) * 2, 2);
+        p += (intPart < 10) + (intPart < 100) + (intPart < 1000);
+    }
+    else {
+        while (intPart >= 100) {
+            p -= 2;
+            std::memcpy(p, Digits2 + (intPart % 100) * 2, 2);
+            intPart /= 100;
+        }
+        if (intPart >= 10) {
+            p -= 2;
+            std::memcpy(p, Digits2 + intPart * 2, 2);
+        }
+        else {
+            *--p = static_cast<char>('0' + intPart);
+        }
+    }
+    // 与 printf 相同，舍入为零的负数保留符号；正数在此写入的 '0' 可作为补零
+    const bool negative = std::signbit(value);
+    *--p = negative ? '-' : '0';
+    return p + (negative ? 0 : 1);
+}
+
+// 与 ostream << fixed << setprecision(p) << setw(w) << setfill('0') 的输出相同：
+// 宽度不足时在最前面补 '0'（负数补在符号之前，如 "00-5.00"）；数值按二进制精确值正确舍入
+void TxtMethod::AppendDouble(std::string& out, double value, int precision) {
+    CheckPrecision(precision);
+    const size_t width = (precision > 0) ? 5 + static_cast<size_t>(precision) : 4;
+
+    // 快速路径结果不超过 32 个字符，前面预先填好补零
+    char fast[64];
+    std::memset(fast, '0', 32);
+    char* const end = fast + sizeof(fast);
+    const char* p = FormatFixedFast(end, value, precision);
+    if (p != nullptr) {
+        const char* first = std::min(p, static_cast<const char*>(end - width));
+        out.append(first, static_cast<size_t>(end - first));
+        return;
+    }
+
+    // 整数部分最多 309 位，另加符号、小数点与小数位
+    char buf[DBL_MAX_10_EXP + MaxPrecision + 4];
+    const std::to_chars_result res = std::to_chars(buf, buf + sizeof(buf), value,
+        std::chars_format::fixed, precision);
+    const size_t len = static_cast<size_t>(res.ptr - buf);
+    if (len < width) {
+        out.append(width - len, '0');
+    }
+    out.append(buf, len);
+}
+
+void TxtMethod::AppendTxtLine(std::string& out, const double* values, size_t count, int precision) {
+    for (size_t j = 0; j < count; ++j) {
+        if (j > 0) {
+            out += ' ';
+        }
+        AppendDouble(out, values[j], precision);
+    }
+    out += '\n';
+}
+
+bool TxtMethod::TxtToBinLog(const std::string& TxtFileName, const std::string& BinFileName,
+    const ColumnSchema& schema, uint64_t calibHash) {
+    std::ifstream probe(TxtFileName);
+    if (!probe.is_open()) {
+        std::cerr << "Error opening file: " << TxtFileName << std::endl;
+        return false;
+    }
+    probe.close();
+
+    try {
+        BinLogWriter writer(BinFileName, schema, calibHash);
+        writer.Append(ReadColumns(TxtFileName, schema));
+        writer.Close();
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Error converting " << TxtFileName << ": " << e.what() << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool TxtMethod::BinLogToTxt(const std::string& BinFileName, const std::string& TxtFileName) {
+    try {
+        BinLogReader reader(BinFileName);
+        std::ofstream file(TxtFileName);
+        if (!file.is_open()) {
+            std::cerr << "Error creating file: " << TxtFileName << std::endl;
+            return false;
+        }
+
+        const ColumnSchema& schema = reader.Schema();
+        std::vector<const double*> f64(schema.Size());
+        std::vector<const int32_t*> i32(schema.Size());
+        std::string buffer;
+        buffer.reserve(WriteBufSize + 4096);
+        for (size_t chunk = 0; chunk < reader.ChunkCount(); ++chunk) {
+            size_t rows = 0;
+            for (size_t j = 0; j < schema.Size(); ++j) {
+                if (schema[j].type == ColumnType::Float64) {
+                    f64[j] = reader.Float64Chunk(j, chunk, rows);
+                }
+                else {
+                    i32[j] = reader.Int32Chunk(j, chunk, rows);
+                }
+            }
+            for (size_t r = 0; r < rows; ++r) {
+                for (size_t j = 0; j < schema.Size(); ++j) {
+                    if (j > 0) {
+                        buffer += ' ';
+                    }
+                    if (schema[j].type == ColumnType::Float64) {
+                        AppendDouble(buffer, f64[j][r]);
+                    }
+                    else {
+                        char num[16];
+                        buffer.append(num, std::to_chars(num, num + sizeof(num), i32[j][r]).ptr);
+                    }
+                }
+                buffer += '\n';
+                if (buffer.size() >= WriteBufSize) {
+                    file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+                    buffer.clear();
+                }
             }
         }
-        file << line << "\n";
+        file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Error converting " << BinFileName << ": " << e.what() << std::endl;
+        return false;
     }
-}
\ No newline at end of file
+    return true;
+}
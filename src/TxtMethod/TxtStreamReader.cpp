@@ -0,0 +1,96 @@
+#include "TxtMethod/TxtStreamReader.h"
+#include <fstream>
+#include <utility>
+#include <stdexcept>
+
+TxtStreamReader::TxtStreamReader(const std::string& FileName, const ColumnSchema& schema,
+    size_t chunkRows, size_t readAhead)
+    : schema_(schema), chunkRows_(chunkRows), readAhead_(readAhead), current_(schema) {
+    if (chunkRows_ == 0 || readAhead_ == 0) {
+        throw std::invalid_argument("chunkRows and readAhead must be positive");
+    }
+    if (!std::ifstream(FileName, std::ios::binary).is_open()) {
+        throw std::runtime_error("Error opening file: " + FileName);
+    }
+
+    worker_ = std::thread([this, FileName]() {
+        TxtMethod txt;
+        txt.ReadChunks(FileName, schema_, chunkRows_, [this](const ColumnTable& chunk) {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_.wait(lock, [this]() { return stop_ || ready_.size() < readAhead_; });
+            if (stop_) {
+                return false;
+            }
+            ColumnTable slot(schema_);
+            if (!free_.empty()) {
+                slot = std::move(free_.back());
+                free_.pop_back();
+            }
+            lock.unlock();
+            slot = chunk;  // 复用的块容量足够时不分配内存
+            lock.lock();
+            ready_.push_back(std::move(slot));
+            cv_.notify_all();
+            return true;
+        });
+        std::lock_guard<std::mutex> lock(mutex_);
+        done_ = true;
+        cv_.notify_all();
+    });
+}
+
+TxtStreamReader::~TxtStreamReader() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    cv_.notify_all();
+    if (worker_.joinable()) {
+        worker_.join();
+    }
+}
+
+bool TxtStreamReader::Next(ColumnTable& chunk) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [this]() { return done_ || !ready_.empty(); });
+    if (ready_.empty()) {
+        return false;
+    }
+    ColumnTable returned = std::move(ready_.front());
+    ready_.pop_front();
+    std::swap(chunk, returned);
+    // 调用方交回的表留作后续块的存储
+    if (free_.size() < readAhead_) {
+        free_.push_back(std::move(returned));
+    }
+    rowsRead_ += chunk.Rows();
+    cv_.notify_all();
+    return true;
+}
+
+TxtStreamReader::RowIterator TxtStreamReader::begin() {
+    return LoadRow() ? RowIterator(this) : RowIterator();
+}
+
+TxtStreamReader::RowIterator& TxtStreamReader::RowIterator::operator++() {
+    ++reader_->rowIndex_;
+    if (!reader_->LoadRow()) {
+        reader_ = nullptr;
+    }
+    return *this;
+}
+
+// 当前块读完时取下一块，并把当前行复制到 row_
+bool TxtStreamReader::LoadRow() {
+    while (rowIndex_ >= current_.Rows()) {
+        if (!Next(current_)) {
+            return false;
+        }
+        rowIndex_ = 0;
+    }
+    row_.resize(current_.Cols());
+    for (size_t j = 0; j < row_.size(); ++j) {
+        row_[j] = current_.Value(rowIndex_, j);
+    }
+    return true;
+}
@@ -0,0 +1,110 @@
+#include "TxtMethod/VarintCodec.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace {
+    uint64_t ZigZag(int64_t value) {
+        return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+    }
+
+    int64_t UnZigZag(uint64_t value) {
+        return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+    }
+
+    void PutVarint(uint64_t value, std::vector<char>& out) {
+        while (value >= 0x80) {
+            out.push_back(static_cast<char>((value & 0x7F) | 0x80));
+            value >>= 7;
+        }
+        out.push_back(static_cast<char>(value));
+    }
+
+    void CheckOrder(int order) {
+        if (order != 1 && order != 2) {
+            throw std::invalid_argument("delta order must be 1 or 2");
+        }
+    }
+}
+
+void VarintCodec::Encode(const int32_t* values, size_t count, int order, std::vector<char>& out) {
+    CheckOrder(order);
+    int64_t prev = 0;
+    int64_t prevDelta = 0;
+    uint64_t zeroRun = 0;
+    for (size_t i = 0; i < count; ++i) {
+        const int64_t delta = static_cast<int64_t>(values[i]) - prev;
+        const int64_t residual = (order == 1) ? delta : delta - prevDelta;
+        prev = values[i];
+        prevDelta = delta;
+        if (residual == 0) {
+            ++zeroRun;
+            continue;
+        }
+        if (zeroRun > 0) {
+            PutVarint((zeroRun << 1) | 1, out);
+            zeroRun = 0;
+        }
+        PutVarint(ZigZag(residual) << 1, out);
+    }
+    if (zeroRun > 0) {
+        PutVarint((zeroRun << 1) | 1, out);
+    }
+}
+
+size_t VarintCodec::Decode(const char* data, size_t size, int order, int32_t* values, size_t count) {
+    CheckOrder(order);
+    const unsigned char* p = reinterpret_cast<const unsigned char*>(data);
+    const unsigned char* const end = p + size;
+    // 在 32 位补码下累加，与 int64 累加后截断的结果相同
+    uint32_t prev = 0;
+    uint32_t prevDelta = 0;
+    size_t i = 0;
+    while (i < count) {
+        if (p == end) {
+            throw std::runtime_error("truncated varint stream");
+        }
+        // 单字节记号（小残差或短游程）最常见，单独处理
+        uint64_t token = *p++;
+        if (token >= 0x80) {
+            token &= 0x7F;
+            int shift = 7;
+            while (true) {
+                if (p == end || shift > 63) {
+                    throw std::runtime_error("malformed varint stream");
+                }
+                const uint64_t byte = *p++;
+                token |= (byte & 0x7F) << shift;
+                if (byte < 0x80) {
+                    break;
+                }
+                shift += 7;
+            }
+        }
+
+        if (token & 1) {
+            const uint64_t run = token >> 1;
+            if (run == 0 || run > count - i) {
+                throw std::runtime_error("malformed varint stream");
+            }
+            const size_t n = static_cast<size_t>(run);
+            if (order == 1) {
+                std::fill(values + i, values + i + n, static_cast<int32_t>(prev));
+            }
+            else {
+                for (size_t k = 0; k < n; ++k) {
+                    prev += prevDelta;
+                    values[i + k] = static_cast<int32_t>(prev);
+                }
+            }
+            i += n;
+        }
+        else {
+            const uint32_t residual = static_cast<uint32_t>(UnZigZag(token >> 1));
+            const uint32_t delta = (order == 1) ? residual : prevDelta + residual;
+            prev += delta;
+            prevDelta = delta;
+            values[i++] = static_cast<int32_t>(prev);
+        }
+    }
+    return static_cast<size_t>(p - reinterpret_cast<const unsigned char*>(data));
+}
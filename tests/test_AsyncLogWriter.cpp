@@ -0,0 +1,146 @@
+#include "TxtMethod/AsyncLogWriter.h"
+#include "TxtMethod/TxtMethod.h"
+#include <gtest/gtest.h>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <vector>
+#include <random>
+#include <stdexcept>
+
+static std::string ReadFile(const std::string& FileName) {
+	std::ifstream file(FileName, std::ios::binary);
+	std::stringstream ss;
+	ss << file.rdbuf();
+	return ss.str();
+}
+
+static size_t CountLines(const std::string& text) {
+	size_t n = 0;
+	for (char ch : text) {
+		n += (ch == '\n');
+	}
+	return n;
+}
+
+// 单生产者输出与 WriteTxt 完全一致
+TEST(AsyncLogWriterTest, MatchesWriteTxt) {
+	std::mt19937 rng(7);
+	std::uniform_real_distribution<double> dist(-500.0, 500.0);
+	std::vector<std::vector<double>> rows;
+	for (int i = 0; i < 5000; ++i) {
+		rows.push_back({ dist(rng), dist(rng), dist(rng) });
+	}
+	rows.push_back({});
+	rows.push_back({ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 });
+
+	TxtMethod txt;
+	txt.WriteTxt(rows, "async_ref.txt");
+	{
+		AsyncLogWriter writer("async_out.txt", 1024, OverflowPolicy::Block);
+		for (const auto& row : rows) {
+			EXPECT_TRUE(writer.Log(row));
+		}
+		writer.Flush();
+		EXPECT_EQ(writer.Written(), rows.size());
+		EXPECT_EQ(writer.Dropped(), 0u);
+	}
+	EXPECT_EQ(ReadFile("async_out.txt"), ReadFile("async_ref.txt"));
+}
+
+// Flush 返回后已入队的记录在文件中可见
+TEST(AsyncLogWriterTest, FlushMakesDataVisible) {
+	AsyncLogWriter writer("async_flush.txt", 64, OverflowPolicy::Block, 1000);
+	writer.Log({ 1.0, 2.0, 3.0 });
+	writer.Log({ 4.0, 5.0, 6.0 });
+	writer.Flush();
+	EXPECT_EQ(ReadFile("async_flush.txt"), "0001.00 0002.00 0003.00\n0004.00 0005.00 0006.00\n");
+}
+
+// 容量向上取 2 的幂，非法容量抛出异常
+TEST(AsyncLogWriterTest, Capacity) {
+	AsyncLogWriter writer("async_cap.txt", 100);
+	EXPECT_EQ(writer.Capacity(), 128u);
+	EXPECT_EQ(writer.Policy(), OverflowPolicy::DropNewest);
+	EXPECT_THROW(AsyncLogWriter("async_cap.txt", 1), std::invalid_argument);
+	EXPECT_THROW(AsyncLogWriter("no_such_dir/async.txt"), std::runtime_error);
+}
+
+// 超过 MaxCols 的数值被截断
+TEST(AsyncLogWriterTest, TruncatesColumns) {
+	std::vector<double> row(LogRecord::MaxCols + 3, 1.0);
+	{
+		AsyncLogWriter writer("async_trunc.txt", 16, OverflowPolicy::Block);
+		writer.Log(row);
+	}
+	std::vector<double> expect(LogRecord::MaxCols, 1.0);
+	std::string line;
+	TxtMethod::AppendTxtLine(line, expect.data(), expect.size());
+	EXPECT_EQ(ReadFile("async_trunc.txt"), line);
+}
+
+// 多生产者 + Block：不丢失记录
+TEST(AsyncLogWriterTest, MultiProducerBlock) {
+	const int threads = 4;
+	const int perThread = 20000;
+	{
+		AsyncLogWriter writer("async_block.txt", 64, OverflowPolicy::Block);
+		std::vector<std::thread> producers;
+		for (int t = 0; t < threads; ++t) {
+			producers.emplace_back([&writer, t]() {
+				for (int i = 0; i < perThread; ++i) {
+					writer.Log({ static_cast<double>(t), static_cast<double>(i) });
+				}
+			});
+		}
+		for (auto& p : producers) {
+			p.join();
+		}
+		writer.Flush();
+		EXPECT_EQ(writer.Written(), static_cast<uint64_t>(threads * perThread));
+		EXPECT_EQ(writer.Dropped(), 0u);
+	}
+
+	// 每个生产者的记录保持各自的先后顺序
+	TxtMethod txt;
+	std::vector<std::vector<double>> rows = txt.ReadColumns("async_block.txt", ColumnSchema::Doubles(2)).ToRows();
+	ASSERT_EQ(rows.size(), static_cast<size_t>(threads * perThread));
+	std::vector<int> next(threads, 0);
+	for (const auto& row : rows) {
+		int t = static_cast<int>(row[0]);
+		ASSERT_GE(t, 0);
+		ASSERT_LT(t, threads);
+		EXPECT_EQ(static_cast<int>(row[1]), next[t]);
+		next[t] = static_cast<int>(row[1]) + 1;
+	}
+}
+
+// DropNewest / DropOldest：写入数 + 丢弃数 = 提交数
+TEST(AsyncLogWriterTest, DropPoliciesAccountForEveryRecord) {
+	for (OverflowPolicy policy : { OverflowPolicy::DropNewest, OverflowPolicy::DropOldest }) {
+		const int threads = 3;
+		const int perThread = 30000;
+		uint64_t written = 0;
+		uint64_t dropped = 0;
+		{
+			AsyncLogWriter writer("async_drop.txt", 4, policy, 50);
+			std::vector<std::thread> producers;
+			for (int t = 0; t < threads; ++t) {
+				producers.emplace_back([&writer]() {
+					for (int i = 0; i < perThread; ++i) {
+						writer.Log({ 1.0, 2.0, 3.0 });
+					}
+				});
+			}
+			for (auto& p : producers) {
+				p.join();
+			}
+			writer.Flush();
+			written = writer.Written();
+			dropped = writer.Dropped();
+		}
+		EXPECT_EQ(written + dropped, static_cast<uint64_t>(threads * perThread));
+		EXPECT_GT(dropped, 0u);
+		EXPECT_EQ(CountLines(ReadFile("async_drop.txt")), written);
+	}
+}
@@ -0,0 +1,311 @@
+#include "TxtMethod/BinLog.h"
+#include "TxtMethod/TxtMethod.h"
+#include "TxtMethod/VarintCodec.h"
+#include "MappedFile.h"
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <cstring>
+#include <array>
+#include <climits>
+#include <stdexcept>
+
+namespace fs = std::filesystem;
+
+// 写入后按块、按行读取，数据逐位一致
+TEST(BinLogTest, WriteRead) {
+	const std::string binFile = "binlog_rw.wtlg";
+	ColumnSchema schema = ColumnSchema::Pose6();
+	schema.Add("count", ColumnType::Int32);
+	const uint64_t hash = BinLog::HashCalibration({ 0.0899, -0.7703, 0.9834 });
+
+	std::mt19937 rng(1);
+	std::uniform_real_distribution<double> dist(-1e3, 1e3);
+	std::vector<std::vector<double>> rows;
+	for (int i = 0; i < 2500; ++i) {
+		std::vector<double> row;
+		for (int j = 0; j < 6; ++j) {
+			row.push_back(dist(rng));
+		}
+		row.push_back(i - 1000);
+		rows.push_back(row);
+	}
+
+	{
+		BinLogWriter writer(binFile, schema, hash, 1000);
+		for (size_t i = 0; i < 1200; ++i) {
+			writer.AppendRow(rows[i]);
+		}
+		// 整表追加跨越块边界
+		ColumnTable table(schema);
+		for (size_t i = 1200; i < rows.size(); ++i) {
+			table.AppendRow(rows[i]);
+		}
+		writer.Append(table);
+		EXPECT_EQ(writer.Rows(), rows.size());
+	}
+
+	BinLogReader reader(binFile);
+	EXPECT_EQ(reader.Version(), BinLog::Version);
+	EXPECT_EQ(reader.CalibHash(), hash);
+	EXPECT_EQ(reader.Rows(), rows.size());
+	EXPECT_EQ(reader.ChunkRows(), 1000u);
+	ASSERT_EQ(reader.ChunkCount(), 3u);
+	ASSERT_EQ(reader.Schema().Size(), 7u);
+	EXPECT_EQ(reader.Schema()[3].name, "rx");
+	EXPECT_EQ(reader.Schema()[6].type, ColumnType::Int32);
+
+	size_t n = 0;
+	const double* ry = reader.Float64Chunk(4, 2, n);
+	ASSERT_EQ(n, 500u);
+	EXPECT_EQ(reinterpret_cast<uintptr_t>(ry) % alignof(double), 0u);
+	EXPECT_EQ(ry[499], rows[2499][4]);
+	const int32_t* count = reader.Int32Chunk(6, 1, n);
+	ASSERT_EQ(n, 1000u);
+	EXPECT_EQ(count[0], 0);
+
+	for (size_t i = 0; i < rows.size(); i += 37) {
+		for (size_t j = 0; j < 7; ++j) {
+			EXPECT_EQ(reader.Value(i, j), rows[i][j]);
+		}
+	}
+	EXPECT_EQ(reader.ReadAll().ToRows(), rows);
+
+	EXPECT_THROW(reader.Int32Chunk(0, 0, n), std::invalid_argument);
+	EXPECT_THROW(reader.Float64Chunk(0, 3, n), std::out_of_range);
+	EXPECT_THROW(reader.Value(rows.size(), 0), std::out_of_range);
+	fs::remove(binFile);
+}
+
+// 与文本格式互相转换
+TEST(BinLogTest, TextConversion) {
+	const std::string txtFile = "binlog_src.txt";
+	const std::string binFile = "binlog_conv.wtlg";
+	const std::string outFile = "binlog_out.txt";
+
+	TxtMethod txt;
+	std::vector<std::vector<double>> data = { { 123.456, 78.9, 0.123 }, { 9999.99, 5.0, 3.14159 } };
+	txt.WriteTxt(data, txtFile);
+
+	ASSERT_TRUE(txt.TxtToBinLog(txtFile, binFile, ColumnSchema::Point3(), 42));
+	BinLogReader reader(binFile);
+	EXPECT_EQ(reader.CalibHash(), 42u);
+	EXPECT_EQ(reader.ReadAll().ToRows(), txt.ReadData(txtFile));
+	ASSERT_TRUE(txt.BinLogToTxt(binFile, outFile));
+
+	std::ifstream a(txtFile), b(outFile);
+	std::string sa((std::istreambuf_iterator<char>(a)), {}), sb((std::istreambuf_iterator<char>(b)), {});
+	EXPECT_EQ(sa, sb);
+	EXPECT_EQ(sa, "0123.46 0078.90 0000.12\n9999.99 0005.00 0003.14\n");
+
+	EXPECT_FALSE(txt.TxtToBinLog("not_exist_file.txt", binFile, ColumnSchema::Point3()));
+	EXPECT_FALSE(txt.BinLogToTxt("not_exist_file.wtlg", outFile));
+	a.close();
+	b.close();
+	fs::remove(txtFile);
+	fs::remove(binFile);
+	fs::remove(outFile);
+}
+
+// 格式错误或截断的文件
+TEST(BinLogTest, RejectsCorruptFile) {
+	const std::string binFile = "binlog_bad.wtlg";
+	{
+		BinLogWriter writer(binFile, ColumnSchema::Point3(), 0, 16);
+		for (int i = 0; i < 40; ++i) {
+			writer.AppendRow({ 1.0 * i, 2.0, 3.0 });
+		}
+	}
+	fs::resize_file(binFile, fs::file_size(binFile) - 8);
+	EXPECT_THROW(BinLogReader{ binFile }, std::runtime_error);
+
+	{
+		std::ofstream out(binFile, std::ios::binary | std::ios::trunc);
+		out << "0000.00 0000.00 0000.00\n";
+	}
+	EXPECT_THROW(BinLogReader{ binFile }, std::runtime_error);
+	EXPECT_THROW(BinLogReader{ "not_exist_file.wtlg" }, std::runtime_error);
+	EXPECT_THROW(BinLogWriter(binFile, ColumnSchema(), 0), std::invalid_argument);
+	fs::remove(binFile);
+}
+
+// 差分编码往返一致，含 int32 极值跳变与游程
+TEST(VarintCodecTest, RoundTrip) {
+	std::mt19937 rng(9);
+	std::vector<std::vector<int32_t>> cases = {
+		{},
+		{ 0 },
+		{ INT32_MAX, INT32_MIN, INT32_MAX, 0, INT32_MIN, INT32_MIN, -1 },
+		std::vector<int32_t>(1000, 150),
+	};
+	std::vector<int32_t> ramp;
+	for (int i = 0; i < 5000; ++i) {
+		ramp.push_back(100000 + 150 * i + ((i % 400 == 0) ? 3 : 0));
+	}
+	cases.push_back(ramp);
+	std::vector<int32_t> noise;
+	std::uniform_int_distribution<int32_t> dist(INT32_MIN, INT32_MAX);
+	for (int i = 0; i < 5000; ++i) {
+		noise.push_back((i % 3) ? dist(rng) : noise.empty() ? 0 : noise.back());
+	}
+	cases.push_back(noise);
+
+	for (int order : { 1, 2 }) {
+		for (const auto& values : cases) {
+			std::vector<char> buf(3, 'x');  // 追加到已有内容之后
+			VarintCodec::Encode(values.data(), values.size(), order, buf);
+			std::vector<int32_t> out(values.size());
+			const size_t used = VarintCodec::Decode(buf.data() + 3, buf.size() - 3, order, out.data(), out.size());
+			EXPECT_EQ(used, buf.size() - 3);
+			EXPECT_EQ(out, values);
+			if (!values.empty()) {
+				EXPECT_THROW(VarintCodec::Decode(buf.data() + 3, used - 1, order, out.data(), out.size()), std::runtime_error);
+			}
+		}
+	}
+
+	// 匀速运动：位置按二阶差分、增量按一阶差分编码只需几个字节
+	std::vector<char> buf;
+	VarintCodec::Encode(cases[3].data(), cases[3].size(), 1, buf);
+	EXPECT_LE(buf.size(), 6u);
+	buf.clear();
+	VarintCodec::Encode(ramp.data(), ramp.size(), 2, buf);
+	EXPECT_LT(buf.size(), 100u);
+
+	int32_t v = 0;
+	EXPECT_THROW(VarintCodec::Encode(&v, 1, 3, buf), std::invalid_argument);
+	const char badRun[] = { static_cast<char>(0x05) };  // 游程长度 2 超过剩余个数
+	EXPECT_THROW(VarintCodec::Decode(badRun, 1, 1, &v, 1), std::runtime_error);
+}
+
+// 差分编码列：往返一致，整数增量与位置日志压缩 10 倍以上
+TEST(BinLogTest, DeltaEncodedColumns) {
+	const std::string rawFile = "binlog_raw.wtlg";
+	const std::string packedFile = "binlog_packed.wtlg";
+
+	// 模拟焊接过程：匀速插补增量 (0.001 mm / 0.0001 度)，每 8 个周期一次跟踪纠偏；位置为增量累加
+	std::mt19937 rng(17);
+	std::uniform_int_distribution<int> corr(-3, 3);
+	std::vector<std::vector<double>> rows;
+	std::array<double, 6> inc = { 150, 0, 0, 0, 0, 0 };
+	std::array<double, 6> pos = { 500000, -20000, 300000, 1800000, 0, 900000 };
+	for (int i = 0; i < 60000; ++i) {
+		if (i % 8 == 0) {
+			inc[1] = corr(rng);
+			inc[2] = corr(rng);
+		}
+		std::vector<double> row(inc.begin(), inc.end());
+		for (int j = 0; j < 6; ++j) {
+			pos[j] += inc[j];
+			row.push_back(pos[j]);
+		}
+		row.push_back(0.5 * i);  // double 列保持原始存储
+		rows.push_back(row);
+	}
+
+	auto makeSchema = [](bool packed) {
+		ColumnSchema schema = ColumnSchema::IncData(packed ? ColumnCodec::Delta : ColumnCodec::Raw);
+		for (const char* name : { "x", "y", "z", "rx", "ry", "rz" }) {
+			schema.Add(name, ColumnType::Int32, packed ? ColumnCodec::Delta2 : ColumnCodec::Raw);
+		}
+		schema.Add("t");
+		return schema;
+	};
+	{
+		BinLogWriter raw(rawFile, makeSchema(false), 0, 8192);
+		BinLogWriter packed(packedFile, makeSchema(true), 0, 8192);
+		for (const auto& row : rows) {
+			raw.AppendRow(row);
+			packed.AppendRow(row);
+		}
+	}
+
+	BinLogReader reader(packedFile);
+	EXPECT_EQ(reader.Schema()[0].codec, ColumnCodec::Delta);
+	EXPECT_EQ(reader.Schema()[6].codec, ColumnCodec::Delta2);
+	EXPECT_EQ(reader.Schema()[12].codec, ColumnCodec::Raw);
+	EXPECT_EQ(reader.ReadAll().ToRows(), rows);
+	EXPECT_EQ(BinLogReader(rawFile).ReadAll().ToRows(), rows);
+	for (size_t i = 0; i < rows.size(); i += 997) {
+		EXPECT_EQ(reader.Value(i, 7), rows[i][7]);
+	}
+	size_t n = 0;
+	const int32_t* x = reader.Int32Chunk(6, 7, n);
+	ASSERT_EQ(n, 60000u - 7 * 8192u);
+	EXPECT_EQ(x[n - 1], rows.back()[6]);
+
+	// 整数列的压缩比（double 列两个文件相同）
+	const double doubleBytes = rows.size() * sizeof(double);
+	const double rawInt = fs::file_size(rawFile) - doubleBytes;
+	const double packedInt = fs::file_size(packedFile) - doubleBytes;
+	EXPECT_GT(rawInt / packedInt, 10.0) << rawInt << " " << packedInt;
+
+	EXPECT_THROW(BinLogWriter(rawFile, ColumnSchema({ { "t", ColumnType::Float64, ColumnCodec::Delta } })), std::invalid_argument);
+	fs::remove(rawFile);
+	fs::remove(packedFile);
+}
+
+// 版本 1 文件（无编码字节与索引）仍可读取
+TEST(BinLogTest, ReadsVersion1) {
+	const std::string binFile = "binlog_v1.wtlg";
+	{
+		std::vector<char> bytes(32, 0);
+		auto put = [&bytes](size_t offset, const void* value, size_t size) {
+			std::memcpy(bytes.data() + offset, value, size);
+		};
+		const uint16_t version = 1, cols = 2;
+		const uint32_t chunkRows = 2;
+		const uint64_t rows = 3, hash = 7;
+		std::memcpy(bytes.data(), BinLog::Magic, 4);
+		put(4, &version, 2);
+		put(6, &cols, 2);
+		put(8, &chunkRows, 4);
+		put(16, &rows, 8);
+		put(24, &hash, 8);
+		for (const char* desc : { "\x00\x01x", "\x01\x01n" }) {
+			bytes.insert(bytes.end(), desc, desc + 3);
+		}
+		bytes.resize(40, 0);
+		const uint32_t headerBytes = 40;
+		put(12, &headerBytes, 4);
+		auto append = [&bytes](const void* data, size_t size) {
+			const char* p = static_cast<const char*>(data);
+			bytes.insert(bytes.end(), p, p + size);
+			bytes.resize((bytes.size() + 7) & ~size_t(7), 0);
+		};
+		const double x0[] = { 1.5, 2.5 }, x1[] = { 3.5 };
+		const int32_t n0[] = { 10, 20 }, n1[] = { 30 };
+		append(x0, sizeof(x0));
+		append(n0, sizeof(n0));
+		append(x1, sizeof(x1));
+		append(n1, sizeof(n1));
+		std::ofstream out(binFile, std::ios::binary);
+		out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+	}
+	BinLogReader reader(binFile);
+	EXPECT_EQ(reader.Version(), 1u);
+	EXPECT_EQ(reader.CalibHash(), 7u);
+	EXPECT_EQ(reader.Schema()[1].codec, ColumnCodec::Raw);
+	EXPECT_EQ(reader.ReadAll().ToRows(), std::vector<std::vector<double>>({ { 1.5, 10 }, { 2.5, 20 }, { 3.5, 30 } }));
+	fs::remove(binFile);
+}
+
+TEST(MappedFileTest, MapAndMove) {
+	const std::string file = "mapped.bin";
+	{
+		std::ofstream out(file, std::ios::binary);
+		out << "WeldTrack";
+	}
+	WeldTrackApp::MappedFile mapped(file);
+	ASSERT_TRUE(mapped.IsOpen());
+	ASSERT_EQ(mapped.Size(), 9u);
+	EXPECT_EQ(std::memcmp(mapped.Data(), "WeldTrack", 9), 0);
+
+	WeldTrackApp::MappedFile moved(std::move(mapped));
+	EXPECT_FALSE(mapped.IsOpen());
+	EXPECT_EQ(moved.Size(), 9u);
+	moved.Close();
+	EXPECT_EQ(moved.Data(), nullptr);
+	fs::remove(file);
+}
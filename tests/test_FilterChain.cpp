@@ -0,0 +1,107 @@
+#include "RobotMethod/FilterChain.h"
+#include "RobotMethod/SeamKalmanTracker.h"
+#include "RobotMethod/TrackAlgMethod.h"
+#include <gtest/gtest.h>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <type_traits>
+#include <stdexcept>
+
+using namespace WeldTrackApp;
+using namespace WeldTrackApp::FilterPolicy;
+
+// 策略链为普通值类型，不含虚函数
+static_assert(!std::is_polymorphic<FilterChain<Median<5>, Kalman<CV>, EMA>>::value,
+    "FilterChain must not use virtual dispatch");
+static_assert(FilterChain<Median<5>, Kalman<CV>, EMA>::StageNum == 3, "stage count");
+
+// Kalman<RW> 与 mea_Pos_Filter（不补点时即 Cal_KalmanFilter）逐点一致
+TEST(FilterChainTest, KalmanRWMatchesMeaPosFilter) {
+    const double r = 0.1;
+    const double q = 0.01;
+    AxisFilter<FilterChain<Kalman<RW>>> filter(
+        FilterChain<Kalman<RW>>(Kalman<RW>(r, q)),
+        FilterChain<Kalman<RW>>(Kalman<RW>(r, q)),
+        FilterChain<Kalman<RW>>(Kalman<RW>(r, q)));
+    TrackAlgMethod alg;
+
+    std::mt19937 rng(7);
+    std::normal_distribution<double> noise(0.0, 0.2);
+    std::vector<std::vector<double>> history;
+    for (int i = 0; i < 260; ++i) {
+        history.push_back({ 0.15 * i + noise(rng), 2.0 + noise(rng), noise(rng) });
+        auto out = filter.Update(history.back());
+        if (history.size() >= static_cast<size_t>(MacroDefine::filterDelay)) {
+            EXPECT_EQ(out, alg.mea_Pos_Filter(history, r, q));
+        }
+    }
+}
+
+// Kalman<CV> 与 SeamCVTracker 单轴逐位一致
+TEST(FilterChainTest, KalmanCVMatchesSeamCVTracker) {
+    FilterChain<Kalman<CV>> chain(Kalman<CV>(0.01, 5.0, 0.02));
+    SeamCVTracker tracker(0.01, 5.0, 0.02);
+
+    for (int i = 0; i < 300; ++i) {
+        double x = 0.15 * i + 0.01 * (i % 7);
+        double y = chain.Update(x);
+        auto ref = tracker.Update({ x, 0.0, 0.0 });
+        EXPECT_EQ(y, ref[0]);
+    }
+    EXPECT_EQ(chain.Stage<0>().Velocity(), tracker.GetVelocity()[0]);
+}
+
+// 串联顺序与逐级手工调用相同，三轴分别配置
+TEST(FilterChainTest, ComposesStagesPerAxis) {
+    using XYChain = FilterChain<Median<5>, Kalman<CV>, EMA>;
+    using ZChain = FilterChain<EMA>;
+    AxisFilter<XYChain, XYChain, ZChain> filter(
+        XYChain(Median<5>(), Kalman<CV>(), EMA(0.46)),
+        XYChain(Median<5>(), Kalman<CV>(), EMA(0.46)),
+        ZChain(EMA(0.30)));
+
+    Median<5> median;
+    Kalman<CV> kalman;
+    EMA emaXY(0.46);
+    EMA emaZ(0.30);
+
+    std::mt19937 rng(9);
+    std::normal_distribution<double> noise(0.0, 0.1);
+    for (int i = 0; i < 100; ++i) {
+        std::vector<double> pt = { 0.15 * i + noise(rng), 1.0, -1.0 + noise(rng) };
+        auto out = filter.Update(pt);
+        EXPECT_DOUBLE_EQ(out[0], emaXY.Update(kalman.Update(median.Update(pt[0]))));
+        EXPECT_DOUBLE_EQ(out[2], emaZ.Update(pt[2]));
+    }
+
+    // 空链原样输出
+    FilterChain<> identity;
+    EXPECT_DOUBLE_EQ(identity.Update(3.5), 3.5);
+}
+
+// 中位数级剔除单点尖峰
+TEST(FilterChainTest, MedianRemovesSpike) {
+    FilterChain<Median<5>> chain;
+    std::vector<double> in = { 1, 1, 1, 9, 1, 1, 2, 2, 2, 2 };
+    std::vector<double> out;
+    for (double x : in) {
+        out.push_back(chain.Update(x));
+    }
+    EXPECT_DOUBLE_EQ(*std::max_element(out.begin(), out.end()), 2.0);
+    EXPECT_DOUBLE_EQ(out[1], 1.0);   // 偶数个样本取中间两值平均
+    EXPECT_DOUBLE_EQ(out.back(), 2.0);
+
+    chain.Reset();
+    EXPECT_DOUBLE_EQ(chain.Update(-4.0), -4.0);
+}
+
+TEST(FilterChainTest, InvalidParameters) {
+    EXPECT_THROW(EMA(0.0), std::invalid_argument);
+    EXPECT_THROW(EMA(1.5), std::invalid_argument);
+    EXPECT_THROW(Kalman<RW>(0.0, 0.1), std::invalid_argument);
+    EXPECT_THROW(Kalman<CV>(0.0), std::invalid_argument);
+
+    AxisFilter<FilterChain<EMA>> filter;
+    EXPECT_THROW(filter.Update({ 1.0, 2.0 }), std::invalid_argument);
+}
@@ -0,0 +1,178 @@
+#include "RobotMethod/FlightRecorder.h"
+#include <gtest/gtest.h>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <vector>
+#include <string>
+#include <stdexcept>
+#include <filesystem>
+#include <cstdio>
+
+using namespace WeldTrackApp;
+
+namespace {
+    std::string ReadFile(const std::string& FileName)
+    {
+        std::ifstream file(FileName, std::ios::binary);
+        std::stringstream ss;
+        ss << file.rdbuf();
+        return ss.str();
+    }
+
+    size_t CountLines(const std::string& text)
+    {
+        size_t n = 0;
+        for (char ch : text) {
+            n += (ch == '\n');
+        }
+        return n;
+    }
+}
+
+// 写满后保留最新的 Capacity() 条记录，且按写入顺序排列
+TEST(FlightRecorderTest, KeepsNewestRecords) {
+    FlightRecorder recorder(100);
+    EXPECT_EQ(recorder.Capacity(), 128u);
+
+    for (int i = 0; i < 1000; ++i) {
+        const double value = i * 0.5;
+        recorder.Record(FlightEvent::Mark, i, &value, 1);
+    }
+    EXPECT_EQ(recorder.Recorded(), 1000u);
+
+    const std::vector<FlightRecord> records = recorder.Snapshot();
+    ASSERT_EQ(records.size(), 128u);
+    for (size_t i = 0; i < records.size(); ++i) {
+        const int code = static_cast<int>(1000 - 128 + i);
+        EXPECT_EQ(records[i].code, code);
+        ASSERT_EQ(records[i].count, 1u);
+        EXPECT_DOUBLE_EQ(records[i].values[0], code * 0.5);
+        if (i > 0) {
+            EXPECT_GE(records[i].timeUs, records[i - 1].timeUs);
+        }
+    }
+}
+
+// 数值个数超过 MaxValues 时截断；辅助函数写入对应的事件与数值
+TEST(FlightRecorderTest, RecordHelpers) {
+    FlightRecorder recorder(16);
+    std::vector<double> many(20, 3.0);
+    recorder.Record(FlightEvent::RobotStatus, 7, many.data(), many.size());
+    recorder.RecordStripe(12, 240.5, 611.25, true);
+    const double xyz[3] = { 1.0, 2.0, 3.0 };
+    recorder.RecordPoint(12, xyz);
+    IncPt incs[2] = { { { 1, 2, 3, 4, 5, 6 } }, { { -1, -2, -3, -4, -5, -6 } } };
+    recorder.RecordIncs(99, incs, 2);
+    recorder.RecordStatus(TrackStatus::Track_Runing);
+    recorder.Record(FlightEvent::Mark, 5, nullptr, 0);  // 无数值的记录可传空指针
+
+    const std::vector<FlightRecord> records = recorder.Snapshot();
+    ASSERT_EQ(records.size(), 7u);
+    EXPECT_EQ(records[0].count, FlightRecord::MaxValues);
+    EXPECT_EQ(records[1].event, FlightEvent::Stripe);
+    EXPECT_DOUBLE_EQ(records[1].values[1], 611.25);
+    EXPECT_DOUBLE_EQ(records[1].values[2], 1.0);
+    EXPECT_EQ(records[2].event, FlightEvent::FilteredPoint);
+    EXPECT_DOUBLE_EQ(records[2].values[2], 3.0);
+    EXPECT_EQ(records[3].event, FlightEvent::SentInc);
+    EXPECT_EQ(records[3].code, 99);
+    EXPECT_DOUBLE_EQ(records[4].values[5], -6.0);
+    EXPECT_EQ(records[5].event, FlightEvent::Status);
+    EXPECT_EQ(records[5].code, static_cast<int32_t>(TrackStatus::Track_Runing));
+    EXPECT_EQ(records[5].count, 0u);
+    EXPECT_EQ(records[6].event, FlightEvent::Mark);
+    EXPECT_EQ(records[6].code, 5);
+    EXPECT_EQ(records[6].count, 0u);
+}
+
+// 多线程同时写入，记录不丢失、不交错
+TEST(FlightRecorderTest, ConcurrentRecord) {
+    const int threadNum = 4;
+    const int perThread = 5000;
+    FlightRecorder recorder(threadNum * perThread);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadNum; ++t) {
+        threads.emplace_back([&recorder, t]() {
+            for (int i = 0; i < perThread; ++i) {
+                const double values[2] = { static_cast<double>(t), static_cast<double>(i) };
+                recorder.Record(FlightEvent::Mark, t * perThread + i, values, 2);
+            }
+        });
+    }
+    for (std::thread& th : threads) {
+        th.join();
+    }
+
+    const std::vector<FlightRecord> records = recorder.Snapshot();
+    ASSERT_EQ(records.size(), static_cast<size_t>(threadNum * perThread));
+    std::vector<int> next(threadNum, 0);
+    for (const FlightRecord& rec : records) {
+        const int t = static_cast<int>(rec.values[0]);
+        ASSERT_GE(t, 0);
+        ASSERT_LT(t, threadNum);
+        EXPECT_EQ(rec.code, t * perThread + static_cast<int>(rec.values[1]));
+        // 同一线程的记录保持写入顺序
+        EXPECT_EQ(static_cast<int>(rec.values[1]), next[t]);
+        next[t] = static_cast<int>(rec.values[1]) + 1;
+    }
+}
+
+// 同步转储：文件头两行，之后每条记录一行
+TEST(FlightRecorderTest, DumpToFile) {
+    FlightRecorder recorder(8);
+    recorder.RecordStripe(1, 10.5, 20.25, false);
+    recorder.RecordStatus(TrackStatus::Wait_Track_Stop);
+
+    EXPECT_EQ(recorder.Dump("flight_dump.txt", "manual"), 2u);
+    const std::string text = ReadFile("flight_dump.txt");
+    EXPECT_EQ(CountLines(text), 4u);
+    EXPECT_NE(text.find("manual"), std::string::npos);
+    EXPECT_NE(text.find(" Stripe 1 10.5 20.25 0\n"), std::string::npos);
+    EXPECT_NE(text.find(" Status 4\n"), std::string::npos);
+    std::remove("flight_dump.txt");
+
+    EXPECT_THROW(recorder.Dump("no_such_dir/flight_dump.txt"), std::runtime_error);
+    EXPECT_THROW(FlightRecorder(1), std::invalid_argument);
+}
+
+// 故障触发后台转储；转储完成前的重复触发不产生新的转储
+TEST(FlightRecorderTest, TriggerDumpsInBackground) {
+    const std::string dumpDir = "flight_dumps";
+    std::filesystem::remove_all(dumpDir);
+    std::filesystem::create_directory(dumpDir);
+    FlightRecorder recorder(64, dumpDir);
+    for (int i = 0; i < 10; ++i) {
+        const double xyz[3] = { i * 1.0, 0.0, 0.0 };
+        recorder.RecordPoint(i, xyz);
+    }
+    recorder.Trigger(FlightFault::RecvCrcError, "crc");
+    ASSERT_TRUE(recorder.WaitDump(std::chrono::seconds(10)));
+    EXPECT_EQ(recorder.DumpCount(), 1u);
+
+    const std::string fileName = recorder.LastDumpFile();
+    ASSERT_FALSE(fileName.empty());
+    const std::string text = ReadFile(fileName);
+    // 10 个滤波点与 1 条故障记录
+    EXPECT_EQ(CountLines(text), 2u + 11u);
+    EXPECT_NE(text.find(" Fault 1\n"), std::string::npos);
+
+    for (int i = 0; i < 50; ++i) {
+        recorder.Trigger(FlightFault::SendTimeout);
+    }
+    ASSERT_TRUE(recorder.WaitDump(std::chrono::seconds(10)));
+    EXPECT_GE(recorder.DumpCount(), 2u);
+    EXPECT_LT(recorder.DumpCount(), 51u);
+    std::filesystem::remove_all(dumpDir);
+}
+
+// 未设置转储目录时只记录故障
+TEST(FlightRecorderTest, TriggerWithoutDumpDir) {
+    FlightRecorder recorder(8);
+    recorder.Trigger(FlightFault::Request);
+    EXPECT_TRUE(recorder.WaitDump(std::chrono::milliseconds(0)));
+    EXPECT_EQ(recorder.DumpCount(), 0u);
+    ASSERT_EQ(recorder.Snapshot().size(), 1u);
+    EXPECT_EQ(recorder.Snapshot()[0].event, FlightEvent::Fault);
+}
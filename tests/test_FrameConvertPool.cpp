@@ -0,0 +1,69 @@
+#include "gtest/gtest.h"
+#include "RobotMethod/FrameConvertPool.h"
+#include "RobotMethod/LaserCoordToTcp.h"
+#include <vector>
+#include <stdexcept>
+
+using namespace WeldTrackApp;
+
+// 构造测试帧：每帧像素点与位姿各不相同，便于检查帧序
+static std::vector<StripeFrame> MakeFrames(size_t frameNum, size_t ptNum) {
+	std::vector<StripeFrame> frames(frameNum);
+	for (size_t i = 0; i < frameNum; ++i) {
+		frames[i].FLPPoint = { 100.0 + i, 20.0, 300.0, 10.0, 5.0 + 0.1 * i, 180.0 };
+		for (size_t j = 0; j < ptNum; ++j) {
+			frames[i].pixelPts.push_back({ 400.0 + 0.5 * j, 600.0 + static_cast<double>(i) });
+		}
+	}
+	return frames;
+}
+
+TEST(FrameConvertPoolTest, ConvertFramesMatchesSerial) {
+	auto frames = MakeFrames(5, 700);
+	FrameConvertPool pool(4, 128);
+	auto results = pool.ConvertFrames(frames);
+
+	LaserCoordToTcp converter;
+	ASSERT_EQ(results.size(), frames.size());
+	for (size_t i = 0; i < frames.size(); ++i) {
+		ASSERT_EQ(results[i].size(), frames[i].pixelPts.size());
+		for (size_t j = 0; j < frames[i].pixelPts.size(); ++j) {
+			auto expect = converter.Cal_LaserMeaPtToBase(
+				frames[i].pixelPts[j][0], frames[i].pixelPts[j][1], frames[i].FLPPoint);
+			EXPECT_EQ(results[i][j], expect);
+		}
+	}
+}
+
+TEST(FrameConvertPoolTest, PopFrameKeepsOrder) {
+	auto frames = MakeFrames(12, 300);
+	FrameConvertPool pool(3, 64);
+	for (const auto& frame : frames) {
+		pool.SubmitFrame(frame);
+	}
+	EXPECT_EQ(pool.PendingFrames(), frames.size());
+
+	LaserCoordToTcp converter;
+	std::vector<std::vector<double>> result;
+	for (size_t i = 0; i < frames.size(); ++i) {
+		ASSERT_TRUE(pool.PopFrame(result, true));
+		ASSERT_EQ(result.size(), frames[i].pixelPts.size());
+		auto expect = converter.Cal_LaserMeaPtToBase(
+			frames[i].pixelPts.back()[0], frames[i].pixelPts.back()[1], frames[i].FLPPoint);
+		EXPECT_EQ(result.back(), expect);
+	}
+	EXPECT_FALSE(pool.PopFrame(result, true));
+}
+
+TEST(FrameConvertPoolTest, InvalidInputThrows) {
+	FrameConvertPool pool(2);
+	auto frames = MakeFrames(3, 50);
+	frames[1].FLPPoint = { 1.0, 2.0, 3.0 };  // 位姿维度错误
+	EXPECT_THROW(pool.ConvertFrames(frames), std::invalid_argument);
+
+	frames = MakeFrames(1, 10);
+	frames[0].pixelPts[3] = { 1.0 };  // 像素点维度错误
+	pool.SubmitFrame(frames[0]);
+	std::vector<std::vector<double>> result;
+	EXPECT_THROW(pool.PopFrame(result, true), std::invalid_argument);
+}
@@ -0,0 +1,144 @@
+#include "ImageMethod/FrameStore.h"
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <cstdio>
+#include <stdexcept>
+
+namespace fs = std::filesystem;
+
+namespace {
+    // 第 n 帧的像素，每个像素与帧号和位置相关
+    std::vector<uint8_t> MakeFrame(uint32_t width, uint32_t height, int n, size_t stride)
+    {
+        std::vector<uint8_t> pixels(stride * height, 0xEE);
+        for (uint32_t r = 0; r < height; ++r) {
+            for (uint32_t c = 0; c < width; ++c) {
+                pixels[r * stride + c] = static_cast<uint8_t>(n * 31 + r * 7 + c);
+            }
+        }
+        return pixels;
+    }
+
+    // 测试用图像文件：文本头 "宽 高\n" 后接原始像素
+    void WriteRawImage(const std::string& FileName, uint32_t width, uint32_t height, int n)
+    {
+        std::ofstream file(FileName, std::ios::binary);
+        file << width << ' ' << height << '\n';
+        const std::vector<uint8_t> pixels = MakeFrame(width, height, n, width);
+        file.write(reinterpret_cast<const char*>(pixels.data()), static_cast<std::streamsize>(pixels.size()));
+    }
+
+    bool DecodeRawImage(const std::string& FileName, std::vector<uint8_t>& pixels, uint32_t& width, uint32_t& height)
+    {
+        std::ifstream file(FileName, std::ios::binary);
+        if (!(file >> width >> height) || file.get() != '\n') {
+            return false;
+        }
+        pixels.resize(static_cast<size_t>(width) * height);
+        file.read(reinterpret_cast<char*>(pixels.data()), static_cast<std::streamsize>(pixels.size()));
+        return static_cast<size_t>(file.gcount()) == pixels.size();
+    }
+}
+
+// 写入后逐帧读取，像素与时间戳一致，帧按缓存行对齐
+TEST(FrameStoreTest, RoundTrip) {
+    const uint32_t width = 37;
+    const uint32_t height = 11;
+    {
+        FrameStoreWriter writer("frames.wtfs", width, height);
+        for (int n = 0; n < 5; ++n) {
+            // 源图像每行带 3 字节填充
+            const std::vector<uint8_t> pixels = MakeFrame(width, height, n, width + 3);
+            writer.Append(pixels.data(), 1000 * n, width + 3);
+        }
+        EXPECT_EQ(writer.Frames(), 5u);
+    }
+
+    FrameStoreReader reader("frames.wtfs");
+    EXPECT_EQ(reader.Width(), width);
+    EXPECT_EQ(reader.Height(), height);
+    EXPECT_EQ(reader.FrameBytes() % FrameStore::FrameAlign, 0u);
+    ASSERT_EQ(reader.Frames(), 5u);
+    for (int n = 0; n < 5; ++n) {
+        const FrameView view = reader.Frame(n);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(view.data) % FrameStore::FrameAlign, 0u);
+        EXPECT_EQ(view.timeUs, 1000 * n);
+        const std::vector<uint8_t> expected = MakeFrame(width, height, n, width);
+        EXPECT_TRUE(std::equal(expected.begin(), expected.end(), view.data));
+    }
+    EXPECT_THROW(reader.Frame(5), std::out_of_range);
+    std::remove("frames.wtfs");
+}
+
+// 格式错误或未正常关闭的文件无法打开
+TEST(FrameStoreTest, RejectsBadFiles) {
+    {
+        std::ofstream file("frames_bad.wtfs", std::ios::binary);
+        file << "not a frame store";
+    }
+    EXPECT_THROW(FrameStoreReader("frames_bad.wtfs"), std::runtime_error);
+    EXPECT_THROW(FrameStoreReader("no_such_file.wtfs"), std::runtime_error);
+    EXPECT_THROW(FrameStoreWriter("frames_bad.wtfs", 0, 10), std::invalid_argument);
+
+    {
+        FrameStoreWriter writer("frames_bad.wtfs", 8, 8);
+        const std::vector<uint8_t> pixels(64, 1);
+        writer.Append(pixels.data(), 0);
+        writer.Close();
+    }
+    // 截去索引
+    fs::resize_file("frames_bad.wtfs", fs::file_size("frames_bad.wtfs") - 4);
+    EXPECT_THROW(FrameStoreReader("frames_bad.wtfs"), std::runtime_error);
+    std::remove("frames_bad.wtfs");
+}
+
+// 目录中的图像按修改时间排序后转换，跳过无法解码和尺寸不同的文件
+TEST(FrameStoreTest, ConvertDirectory) {
+    const std::string dir = "frame_images";
+    fs::remove_all(dir);
+    fs::create_directory(dir);
+
+    // 文件名顺序与修改时间顺序相反
+    const fs::file_time_type base = fs::file_time_type::clock::now();
+    const int frameNum = 6;
+    for (int n = 0; n < frameNum; ++n) {
+        const std::string file = dir + "/" + std::to_string(frameNum - n) + ".raw";
+        WriteRawImage(file, 16, 9, n);
+        fs::last_write_time(file, base + std::chrono::seconds(n));
+    }
+    WriteRawImage(dir + "/big.raw", 32, 9, 0);
+    fs::last_write_time(dir + "/big.raw", base + std::chrono::seconds(100));
+    {
+        std::ofstream file(dir + "/broken.raw");
+        file << "garbage";
+    }
+    std::ofstream(dir + "/ignored.txt") << "1 1\nx";
+
+    const std::vector<std::string> files = FrameStore::ListFrameFiles(dir, ".raw");
+    ASSERT_EQ(files.size(), static_cast<size_t>(frameNum + 2));
+    for (int n = 0; n < frameNum; ++n) {
+        EXPECT_EQ(fs::path(files[n + 1]).filename().string(), std::to_string(frameNum - n) + ".raw");
+    }
+    EXPECT_TRUE(FrameStore::ListFrameFiles("no_such_dir").empty());
+
+    ASSERT_EQ(FrameStore::Convert(files, "frames_conv.wtfs", DecodeRawImage), static_cast<size_t>(frameNum));
+    FrameStoreReader reader("frames_conv.wtfs");
+    ASSERT_EQ(reader.Frames(), static_cast<size_t>(frameNum));
+    for (int n = 0; n < frameNum; ++n) {
+        const FrameView view = reader.Frame(n);
+        const std::vector<uint8_t> expected = MakeFrame(16, 9, n, 16);
+        EXPECT_TRUE(std::equal(expected.begin(), expected.end(), view.data));
+        if (n > 0) {
+            EXPECT_EQ(view.timeUs - reader.Frame(n - 1).timeUs, 1000000);
+        }
+    }
+
+    EXPECT_EQ(FrameStore::Convert({ dir + "/broken.raw" }, "frames_none.wtfs", DecodeRawImage), 0u);
+    EXPECT_FALSE(fs::exists("frames_none.wtfs"));
+    fs::remove_all(dir);
+    std::remove("frames_conv.wtfs");
+}
@@ -0,0 +1,157 @@
+#include "RobotMethod/HampelFilter.h"
+#include "RobotMethod/SeamPosFilter.h"
+#include <gtest/gtest.h>
+#include <vector>
+#include <deque>
+#include <random>
+#include <cmath>
+#include <algorithm>
+#include <stdexcept>
+
+using namespace WeldTrackApp;
+
+namespace {
+    double BruteMedian(std::vector<double> v)
+    {
+        std::sort(v.begin(), v.end());
+        size_t mid = v.size() / 2;
+        return (v.size() % 2) ? v[mid] : (v[mid - 1] + v[mid]) / 2;
+    }
+}
+
+// 与直接排序计算的中位数/MAD 判定结果一致
+TEST(HampelFilterTest, MatchesBruteForce) {
+    const size_t window = 8;
+    const double nSigma = 2.5;
+    const double minSigma = 0.01;
+    HampelFilter filter(window, nSigma, minSigma);
+
+    std::mt19937 rng(11);
+    std::normal_distribution<double> noise(0.0, 0.1);
+    std::bernoulli_distribution spike(0.1);
+    std::deque<double> hist;
+
+    for (int n = 0; n < 2000; ++n) {
+        double x = std::round((noise(rng) + (spike(rng) ? 3.0 : 0.0)) * 100) / 100;  // 含重复值
+        double expect = x;
+        if (hist.size() > window / 2) {
+            std::vector<double> v(hist.begin(), hist.end());
+            double m = BruteMedian(v);
+            std::vector<double> dev;
+            for (double h : v) {
+                dev.push_back(std::fabs(h - m));
+            }
+            double sigma = std::max(1.4826 * BruteMedian(dev), minSigma);
+            if (std::fabs(x - m) / sigma > nSigma) {
+                expect = m;
+            }
+            EXPECT_DOUBLE_EQ(filter.Median(0), m) << n;
+        }
+        auto out = filter.Update({ x, 0.0, 0.0 });
+        EXPECT_DOUBLE_EQ(out[0], expect) << n;
+
+        hist.push_back(x);
+        if (hist.size() > window) {
+            hist.pop_front();
+        }
+    }
+}
+
+// 飞溅尖峰被剔除，卡尔曼滤波输出不再被拉偏
+TEST(HampelFilterTest, RejectsSpikesBeforeKalman) {
+    HampelFilter hampel;
+    SeamPosFilter cleanFilter(0.1, 0.01);
+    SeamPosFilter rawFilter(0.1, 0.01);
+
+    std::mt19937 rng(5);
+    std::normal_distribution<double> noise(0.0, 0.02);
+    double cleanErr = 0.0;
+    double rawErr = 0.0;
+    size_t spikes = 0;
+    for (int i = 0; i < 600; ++i) {
+        std::vector<double> truth = { 0.15 * i, 1.0, -2.0 };
+        std::vector<double> meas = { truth[0] + noise(rng), truth[1] + noise(rng), truth[2] + noise(rng) };
+        if (i > 20 && i % 37 == 0) {
+            meas[1] += 5.0;  // 弧光反射
+            ++spikes;
+        }
+        auto clean = cleanFilter.Update(hampel.Update(meas));
+        auto raw = rawFilter.Update(meas);
+        if (i > 200) {
+            cleanErr = std::max(cleanErr, std::fabs(clean[1] - truth[1]));
+            rawErr = std::max(rawErr, std::fabs(raw[1] - truth[1]));
+        }
+    }
+    EXPECT_LT(cleanErr, 0.05);
+    EXPECT_GT(rawErr, 3 * cleanErr);
+
+    const auto& stats = hampel.GetStats();
+    EXPECT_EQ(stats.samples, 600u);
+    EXPECT_GE(stats.axisRejected[1], spikes);
+    EXPECT_LT(stats.RejectRate(), 0.1);
+}
+
+// 焊缝真实阶跃在半个窗口后被接受
+TEST(HampelFilterTest, AcceptsStepAfterHalfWindow) {
+    HampelFilter hampel(9, 3.0, 0.02);
+    for (int i = 0; i < 20; ++i) {
+        hampel.Update({ 0.0, 0.0, 0.0 });
+    }
+    int rejectedRun = 0;
+    for (int i = 0; i < 10; ++i) {
+        auto out = hampel.Update({ 0.0, 2.0, 0.0, 7.0 });
+        EXPECT_DOUBLE_EQ(out[3], 7.0);  // 其余分量原样保留
+        if (hampel.LastRejected()) {
+            ++rejectedRun;
+            EXPECT_GT(hampel.LastScore(), 3.0);
+        }
+    }
+    EXPECT_EQ(rejectedRun, 5);
+    EXPECT_DOUBLE_EQ(hampel.Median(1), 2.0);
+
+    hampel.Reset();
+    EXPECT_EQ(hampel.GetStats().samples, 0u);
+    EXPECT_THROW(hampel.Median(0), std::out_of_range);
+}
+
+// NaN/Inf 判为离群：以中位数替换，计入统计，不破坏窗口
+TEST(HampelFilterTest, RejectsNonFinite) {
+    HampelFilter hampel(5, 3.0, 0.02);
+    EXPECT_THROW(hampel.Update({ NAN, 0.0, 0.0 }), std::invalid_argument);
+    EXPECT_EQ(hampel.GetStats().samples, 0u);
+
+    hampel.Update({ 1.0, 2.0, 3.0 });
+    auto out = hampel.Update({ NAN, 2.0, INFINITY });
+    EXPECT_DOUBLE_EQ(out[0], 1.0);  // 窗口不足一半时也替换
+    EXPECT_DOUBLE_EQ(out[2], 3.0);
+    EXPECT_TRUE(hampel.LastRejected());
+
+    for (int i = 0; i < 4; ++i) {
+        hampel.Update({ 1.0 + 0.01 * i, 2.0, 3.0 });
+    }
+    out = hampel.Update({ 1.02, -INFINITY, 3.0 });
+    EXPECT_DOUBLE_EQ(out[1], 2.0);
+    EXPECT_TRUE(std::isinf(hampel.LastScore()));
+
+    const auto& stats = hampel.GetStats();
+    EXPECT_EQ(stats.rejected, 2u);
+    EXPECT_EQ(stats.axisRejected[0], 1u);
+    EXPECT_EQ(stats.axisRejected[1], 1u);
+    EXPECT_EQ(stats.axisRejected[2], 1u);
+
+    // 窗口只含有限值：中位数与随后的判定不受影响
+    EXPECT_DOUBLE_EQ(hampel.Median(0), 1.02);
+    EXPECT_DOUBLE_EQ(hampel.Median(1), 2.0);
+    EXPECT_DOUBLE_EQ(hampel.Median(2), 3.0);
+    hampel.Update({ 1.5, 2.0, 3.0 });
+    EXPECT_TRUE(hampel.LastRejected());
+}
+
+TEST(HampelFilterTest, InvalidInput) {
+    EXPECT_THROW(HampelFilter(2), std::invalid_argument);
+    EXPECT_THROW(HampelFilter(5, 0.0), std::invalid_argument);
+
+    HampelFilter hampel;
+    EXPECT_THROW(hampel.Update({ 1.0, 2.0 }), std::invalid_argument);
+    EXPECT_THROW(hampel.Median(3), std::out_of_range);
+}
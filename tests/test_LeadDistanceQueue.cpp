@@ -0,0 +1,115 @@
+#include "RobotMethod/LeadDistanceQueue.h"
+#include <gtest/gtest.h>
+#include <vector>
+#include <random>
+#include <stdexcept>
+
+using namespace WeldTrackApp;
+
+// 焊缝点在焊枪走过"弧长 + 超前距离"后释放，与焊接速度无关
+TEST(LeadDistanceQueueTest, ReleaseByTravelledDistance) {
+    LeadDistanceQueue queue(10.0);
+    EXPECT_DOUBLE_EQ(LeadDistanceQueue().LeadDistance(), MacroDefine::LeadDistance);
+
+    for (int i = 0; i <= 40; ++i) {
+        EXPECT_TRUE(queue.Push({ 1.0 * i, 5.0, 0.0 }));
+    }
+    EXPECT_DOUBLE_EQ(queue.SeamLength(), 40.0);
+
+    LeadDistanceQueue::Point3d pt;
+    EXPECT_FALSE(queue.PopReached(pt));
+
+    // 慢速：每周期 0.05 mm；快速：每周期 0.5 mm，释放时机均只取决于路程
+    double x = -10.0;
+    int released = 0;
+    while (x < 30.0) {
+        x += (x < 5.0) ? 0.05 : 0.5;
+        queue.UpdateTorch({ x, 5.0, 0.0 });
+        while (queue.PopReached(pt)) {
+            EXPECT_LE(pt[0], x + 1e-9);
+            EXPECT_DOUBLE_EQ(pt[0], released);
+            ++released;
+        }
+    }
+    EXPECT_NEAR(queue.TorchDistance(), 40.0, 1e-6);
+    EXPECT_EQ(released, 31);
+    EXPECT_EQ(queue.Size(), 10u);
+}
+
+// 焊枪位于两个焊缝点之间时按弧长插值
+TEST(LeadDistanceQueueTest, InterpolatesCurrentTarget) {
+    LeadDistanceQueue queue(2.0);
+    LeadDistanceQueue::Point3d pt;
+    EXPECT_FALSE(queue.CurrentTarget(pt));
+
+    queue.Push({ 0.0, 0.0, 0.0 });
+    queue.Push({ 3.0, 4.0, 0.0 });   // 弧长 5
+    queue.Push({ 3.0, 4.0, 2.0 });   // 弧长 7
+
+    // 焊枪尚未到达第一个点
+    ASSERT_TRUE(queue.CurrentTarget(pt));
+    EXPECT_DOUBLE_EQ(pt[0], 0.0);
+
+    queue.SetTorchDistance(4.5);  // 焊缝弧长 2.5
+    ASSERT_TRUE(queue.CurrentTarget(pt));
+    EXPECT_DOUBLE_EQ(pt[0], 1.5);
+    EXPECT_DOUBLE_EQ(pt[1], 2.0);
+
+    // 释放后仍可在已释放点与下一个点之间插值
+    EXPECT_TRUE(queue.PopReached(pt));
+    EXPECT_FALSE(queue.PopReached(pt));
+    queue.SetTorchDistance(8.0);  // 焊缝弧长 6
+    EXPECT_TRUE(queue.PopReached(pt));
+    ASSERT_TRUE(queue.CurrentTarget(pt));
+    EXPECT_DOUBLE_EQ(pt[2], 1.0);
+
+    // 路程只增不减
+    queue.SetTorchDistance(1.0);
+    EXPECT_DOUBLE_EQ(queue.TorchDistance(), 8.0);
+
+    ASSERT_TRUE(queue.SeamPointAt(100.0, pt));
+    EXPECT_DOUBLE_EQ(pt[2], 2.0);
+}
+
+// 停顿时的测量抖动不累加到弧长与路程，队列不随停顿时长增长；慢速移动仍完整计入
+TEST(LeadDistanceQueueTest, DwellDoesNotAccumulate) {
+    LeadDistanceQueue queue(5.0);
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<double> jitter(-0.01, 0.01);
+
+    for (int i = 0; i < 5000; ++i) {
+        ASSERT_TRUE(queue.Push({ 10.0 + jitter(rng), 5.0 + jitter(rng), jitter(rng) }));
+        queue.UpdateTorch({ jitter(rng), jitter(rng), 0.0 });
+    }
+    EXPECT_EQ(queue.Size(), 1u);
+    EXPECT_DOUBLE_EQ(queue.SeamLength(), 0.0);
+    EXPECT_DOUBLE_EQ(queue.TorchDistance(), 0.0);
+
+    // 每周期 0.01 mm 的慢速移动小于最小点距，但累计后计入
+    for (int i = 1; i <= 1000; ++i) {
+        queue.Push({ 10.0 + 0.01 * i, 5.0, 0.0 });
+        queue.UpdateTorch({ 0.01 * i, 0.0, 0.0 });
+    }
+    EXPECT_NEAR(queue.SeamLength(), 10.0, queue.MinSpacing());
+    EXPECT_NEAR(queue.TorchDistance(), 10.0, queue.MinSpacing());
+    EXPECT_LE(queue.Size(), static_cast<size_t>(10.0 / queue.MinSpacing()) + 2);
+}
+
+TEST(LeadDistanceQueueTest, CapacityAndInvalidInput) {
+    EXPECT_THROW(LeadDistanceQueue(-1.0), std::invalid_argument);
+    EXPECT_THROW(LeadDistanceQueue(1.0, -0.1), std::invalid_argument);
+
+    LeadDistanceQueue queue(0.0);
+    EXPECT_THROW(queue.Push({ 1.0, 2.0 }), std::invalid_argument);
+    EXPECT_THROW(queue.UpdateTorch({ 1.0 }), std::invalid_argument);
+
+    for (size_t i = 0; i < LeadDistanceQueue::Capacity; ++i) {
+        ASSERT_TRUE(queue.Push({ 0.1 * i, 0.0, 0.0 }));
+    }
+    EXPECT_FALSE(queue.Push({ 0.0, 0.0, 0.0 }));
+
+    queue.Reset();
+    EXPECT_EQ(queue.Size(), 0u);
+    EXPECT_DOUBLE_EQ(queue.SeamLength(), 0.0);
+    EXPECT_TRUE(queue.Push({ 0.0, 0.0, 0.0 }));
+}
@@ -0,0 +1,267 @@
+// 本机回环测试：假控制器监听 127.0.0.1，验证连接、收发分帧与断线重连
+#define MOTOMAN_ROBOT_IP "127.0.0.1"
+#define MOTOMAN_ROBOT_PORT 50247
+#include "RobotMethod/MotoManTCP.h"
+#include <gtest/gtest.h>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <functional>
+
+namespace {
+    // 与 MotoManTCP::cal_crc 相同
+    int Crc(const int* data, int length)
+    {
+        int crc = 0xffff;
+        for (int i = 0; i < length; i++) {
+            crc ^= data[i];
+            for (int j = 0; j < 8; j++) {
+                int flag = crc & 0x01;
+                crc >>= 1;
+                if (flag) {
+                    crc ^= 0xA001;
+                }
+            }
+        }
+        return crc;
+    }
+
+    // 处理一个字的 8 轮移位，在 GF(2) 上是线性变换
+    uint32_t Rounds(uint32_t x)
+    {
+        int32_t crc = static_cast<int32_t>(x);
+        for (int j = 0; j < 8; j++) {
+            int flag = crc & 0x01;
+            crc >>= 1;
+            if (flag) {
+                crc ^= 0xA001;
+            }
+        }
+        return static_cast<uint32_t>(crc);
+    }
+
+    // 控制器的 CRC 覆盖 CRCData 字段本身：求 t 使 Rounds(prev ^ t) == t，即 (t ^ Rounds(t)) == Rounds(prev)
+    bool SolveCrc(uint32_t prev, uint32_t& t)
+    {
+        uint32_t basis[32] = {}, pre[32] = {};
+        for (int i = 0; i < 32; i++) {
+            uint32_t a = (1u << i) ^ Rounds(1u << i);
+            uint32_t p = 1u << i;
+            for (int b = 31; b >= 0 && a != 0; b--) {
+                if (!((a >> b) & 1u)) continue;
+                if (basis[b] == 0) {
+                    basis[b] = a;
+                    pre[b] = p;
+                    break;
+                }
+                a ^= basis[b];
+                p ^= pre[b];
+            }
+        }
+        uint32_t v = Rounds(prev);
+        t = 0;
+        for (int b = 31; b >= 0; b--) {
+            if (!((v >> b) & 1u)) continue;
+            if (basis[b] == 0) return false;
+            v ^= basis[b];
+            t ^= pre[b];
+        }
+        return true;
+    }
+
+    // 填写应答报文的 CRC，无解时改变序列号重试
+    void SealRecvMsg(RobotRecvMsg& msg)
+    {
+        const int words = sizeof(RobotRecvMsg) / sizeof(int);
+        for (;; msg.serialNumber++) {
+            msg.CRCData = 0;
+            uint32_t t;
+            if (SolveCrc(static_cast<uint32_t>(Crc(reinterpret_cast<int*>(&msg), words - 1)), t)) {
+                msg.CRCData = static_cast<int>(t);
+                return;
+            }
+        }
+    }
+
+    bool WaitFor(const std::function<bool()>& cond, int timeout_ms = 5000)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+        while (!cond()) {
+            if (std::chrono::steady_clock::now() > deadline) return false;
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+        return true;
+    }
+
+    // 假控制器：校验每个报文的 CRC，记录插补增量，应答分两次写出以验证接收端拼包
+    class FakeController {
+    public:
+        FakeController()
+        {
+            listen_ = ::socket(AF_INET, SOCK_STREAM, 0);
+            int one = 1;
+            setsockopt(listen_, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+            sockaddr_in addr = {};
+            addr.sin_family = AF_INET;
+            addr.sin_port = htons(MOTOMAN_ROBOT_PORT);
+            inet_pton(AF_INET, MOTOMAN_ROBOT_IP, &addr.sin_addr);
+            ok_ = ::bind(listen_, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) == 0 && ::listen(listen_, 1) == 0;
+            if (ok_) {
+                thread_ = std::thread(&FakeController::Run, this);
+            }
+        }
+
+        ~FakeController()
+        {
+            stop_ = true;
+            ::shutdown(listen_, SHUT_RDWR);
+            DropClient();
+            if (thread_.joinable()) thread_.join();
+            ::close(listen_);
+        }
+
+        bool Ok() const { return ok_; }
+
+        // 断开当前连接
+        void DropClient()
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (client_ >= 0) ::shutdown(client_, SHUT_RDWR);
+        }
+
+        std::vector<std::vector<int>> Incs()
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return incs_;
+        }
+
+        std::atomic<int> accepted{ 0 };
+        std::atomic<int> messages{ 0 };
+        std::atomic<int> crcErrors{ 0 };
+        std::atomic<int> stopMessages{ 0 };
+
+    private:
+        int listen_ = -1;
+        int client_ = -1;
+        bool ok_ = false;
+        std::atomic<bool> stop_{ false };
+        std::thread thread_;
+        std::mutex mutex_;
+        std::vector<std::vector<int>> incs_;
+
+        void Run()
+        {
+            while (!stop_) {
+                int c = ::accept(listen_, nullptr, nullptr);
+                if (c < 0) break;
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    client_ = c;
+                }
+                accepted++;
+                Serve(c);
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    client_ = -1;
+                }
+                ::close(c);
+            }
+        }
+
+        void Serve(int c)
+        {
+            RobotSendMsg msg;
+            while (!stop_) {
+                size_t got = 0;
+                while (got < sizeof(msg)) {
+                    ssize_t n = ::recv(c, reinterpret_cast<char*>(&msg) + got, sizeof(msg) - got, 0);
+                    if (n <= 0) return;
+                    got += static_cast<size_t>(n);
+                }
+                RobotSendMsg check = msg;
+                check.CRCData = 0;
+                if (Crc(reinterpret_cast<int*>(&check), sizeof(check) / sizeof(int)) != msg.CRCData) {
+                    crcErrors++;
+                    continue;
+                }
+                if (msg.ifStopTcp) {
+                    stopMessages++;
+                    continue;
+                }
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    for (int i = 0; i < msg.count; i++) {
+                        incs_.emplace_back(msg.datalist[i].incData, msg.datalist[i].incData + 6);
+                    }
+                }
+                const int n = ++messages;
+
+                RobotRecvMsg reply;
+                reply.CartesianPos[0] = 1000.0 * n;
+                reply.is_CRCOk = 1;
+                SealRecvMsg(reply);
+                const char* bytes = reinterpret_cast<const char*>(&reply);
+                ::send(c, bytes, 10, MSG_NOSIGNAL);
+                std::this_thread::sleep_for(std::chrono::milliseconds(2));
+                ::send(c, bytes + 10, sizeof(reply) - 10, MSG_NOSIGNAL);
+            }
+        }
+    };
+}
+
+// 增量完整送达，应答拼包后更新机器人状态；控制器断开后自动重连并继续下发
+TEST(MotoManTCPTest, LoopbackExchangeAndReconnect) {
+    FakeController controller;
+    ASSERT_TRUE(controller.Ok());
+
+    WeldTrackApp::FlightRecorder recorder(1024);
+    MotoManTCP& tcp = MotoManTCP::GetInstance();
+    tcp.SetFlightRecorder(&recorder);
+
+    std::vector<WeldTrackApp::IncPt> incs(25);
+    for (size_t i = 0; i < incs.size(); i++) {
+        for (int j = 0; j < 6; j++) {
+            incs[i].d[j] = static_cast<int32_t>(i * 10 + j);
+        }
+    }
+    tcp.Gen_SendMsgToQueue(incs);
+
+    ASSERT_TRUE(WaitFor([&]() { return controller.Incs().size() >= 25; }));
+    ASSERT_TRUE(WaitFor([&]() { return tcp.GetRobotStatus().CartesianPos[0] > 0.0; }));
+    EXPECT_EQ(tcp.GetDataStatus(), Tcp_Data_Status::tcpData_ok);
+    EXPECT_EQ(tcp.GetCommStatus(), Tcp_Comm_Status::tcpClient_ok);
+
+    // 断线：通信线程识别为未连接，并按退避间隔重连
+    controller.DropClient();
+    ASSERT_TRUE(WaitFor([&]() { return controller.accepted.load() >= 2; }));
+    const int before = controller.messages.load();
+    tcp.Gen_SendMsgToQueue(incs.data(), 12);
+    ASSERT_TRUE(WaitFor([&]() { return controller.Incs().size() >= 37; }));
+    ASSERT_TRUE(WaitFor([&]() { return controller.messages.load() > before + 2; }));
+    EXPECT_EQ(tcp.GetCommStatus(), Tcp_Comm_Status::tcpClient_ok);
+
+    // 增量按序送达，无错位
+    const std::vector<std::vector<int>> received = controller.Incs();
+    ASSERT_EQ(received.size(), 37u);
+    for (size_t i = 0; i < received.size(); i++) {
+        const size_t k = (i < 25) ? i : i - 25;
+        for (int j = 0; j < 6; j++) {
+            EXPECT_EQ(received[i][j], static_cast<int>(k * 10 + j));
+        }
+    }
+    EXPECT_EQ(controller.crcErrors.load(), 0);
+
+    tcp.Stop();
+    EXPECT_GE(controller.stopMessages.load(), 1);
+
+    size_t sentIncs = 0;
+    size_t statuses = 0;
+    for (const WeldTrackApp::FlightRecord& rec : recorder.Snapshot()) {
+        sentIncs += (rec.event == WeldTrackApp::FlightEvent::SentInc);
+        statuses += (rec.event == WeldTrackApp::FlightEvent::RobotStatus);
+    }
+    EXPECT_EQ(sentIncs, 37u);
+    EXPECT_GT(statuses, 0u);
+}
@@ -0,0 +1,84 @@
+#include "RobotMethod/PathStatistics.h"
+#include "RobotMethod/TrackAlgMethod.h"
+#include <gtest/gtest.h>
+#include <vector>
+#include <cmath>
+#include <stdexcept>
+
+using namespace WeldTrackApp;
+
+namespace {
+    std::vector<std::vector<double>> MakeTeachPath(size_t n)
+    {
+        std::vector<std::vector<double>> rows;
+        rows.reserve(n);
+        for (size_t i = 0; i < n; ++i) {
+            double t = 0.001 * i;
+            rows.push_back({ 100.0 * t, 20.0 * std::sin(t), 5.0 * std::cos(3 * t),
+                             170.0 + 0.02 * i, -10.0, 90.0 - 0.001 * i });
+        }
+        return rows;
+    }
+}
+
+// 串行与并行结果均与 Cal_WeldPara 一致
+TEST(PathStatisticsTest, MatchesCalWeldPara) {
+    auto rows = MakeTeachPath(100000);
+    TrackAlgMethod alg;
+    std::vector<double> incAtt;
+    double totalLen = 0.0;
+    ASSERT_TRUE(alg.Cal_WeldPara(rows, incAtt, totalLen));
+
+    WorkStealingPool pool(4);
+    for (WorkStealingPool* p : { static_cast<WorkStealingPool*>(nullptr), &pool }) {
+        auto path = TrackPathSoA::FromRows(rows, 0, true, p);
+        PathStatistics statistics(p, 4096);
+        PathStats stats;
+        ASSERT_TRUE(statistics.Calculate(path, stats));
+
+        EXPECT_NEAR(stats.totalLen, totalLen, 1e-9 * totalLen);
+        ASSERT_EQ(stats.segLen.size(), rows.size() - 1);
+        ASSERT_EQ(stats.cumLen.size(), rows.size());
+        EXPECT_DOUBLE_EQ(stats.cumLen.front(), 0.0);
+        EXPECT_NEAR(stats.cumLen.back(), totalLen, 1e-9 * totalLen);
+        for (size_t i : { size_t(0), size_t(4095), size_t(4096), size_t(77777), rows.size() - 2 }) {
+            EXPECT_DOUBLE_EQ(stats.segLen[i], alg.Cal_Length(rows[i], rows[i + 1]));
+            EXPECT_NEAR(stats.cumLen[i + 1] - stats.cumLen[i], stats.segLen[i], 1e-9);
+        }
+        for (int k = 0; k < 3; ++k) {
+            EXPECT_DOUBLE_EQ(stats.incAtt[k], incAtt[k]);
+        }
+    }
+}
+
+// trackDatas_Save 行（位置位于第 5-7 个元素）与 Cal_totalLength 一致
+TEST(PathStatisticsTest, MatchesCalTotalLength) {
+    std::vector<std::vector<double>> saved;
+    for (int i = 0; i < 5000; ++i) {
+        saved.push_back({ 0, 0, 0, 0, 0, 0.3 * i, std::sin(0.01 * i), 0.0 });
+    }
+    TrackAlgMethod alg;
+
+    auto path = TrackPathSoA::FromRows(saved, 5, false);
+    PathStats stats;
+    ASSERT_TRUE(PathStatistics(nullptr, 1000).Calculate(path, stats));
+    EXPECT_NEAR(stats.totalLen, alg.Cal_totalLength(saved), 1e-9);
+    EXPECT_EQ(stats.incAtt, std::vector<double>({ 0.0, 0.0, 0.0 }));
+}
+
+TEST(PathStatisticsTest, InvalidInput) {
+    PathStats stats;
+    PathStatistics statistics;
+    EXPECT_FALSE(statistics.Calculate(TrackPathSoA::FromRows({ { 0, 0, 0, 0, 0, 0 } }), stats));
+    EXPECT_DOUBLE_EQ(stats.totalLen, 0.0);
+    EXPECT_EQ(stats.cumLen.size(), 1u);
+
+    EXPECT_THROW(TrackPathSoA::FromRows({ { 0, 0, 0 } }), std::invalid_argument);
+    EXPECT_NO_THROW(TrackPathSoA::FromRows({ { 0, 0, 0 } }, 0, false));
+
+    TrackPathSoA bad;
+    bad.x = { 0.0, 1.0 };
+    bad.y = { 0.0 };
+    bad.z = { 0.0, 1.0 };
+    EXPECT_THROW(statistics.Calculate(bad, stats), std::invalid_argument);
+}
@@ -4,7 +4,7 @@
 
 TEST(PTLCTest, Get3DPoint) {
 	PixelToLaserCoord ptlc;
-	// ֪ת
+	// 已知点的转换
 	std::vector<double> point = ptlc.Get3DPoint(0, 0);
 	ASSERT_EQ(point.size(), 3);
 	EXPECT_NEAR(point[0], -16.1181, 1e-6);
@@ -16,8 +16,8 @@ TEST(PTLCTest, Get2DPoint) {
 	PixelToLaserCoord ptlc;
 	std::vector<double> point = ptlc.Get2DPoint(0, 0);
 	ASSERT_EQ(point.size(), 3);
-	EXPECT_NEAR(point[0], -13.57, 1e-2); // ҪC#õֵ
-	EXPECT_NEAR(point[1], 15.56, 1e-2);  // Ϲ
+	EXPECT_NEAR(point[0], -13.57, 1e-2); // 需要在C#得到这个值
+	EXPECT_NEAR(point[1], 15.56, 1e-2);  // 现在是瞎填的
 	EXPECT_NEAR(point[2], 52.32, 1e-2);
 }
 
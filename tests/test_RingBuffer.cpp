@@ -0,0 +1,42 @@
+#include "RingBuffer.h"
+#include <gtest/gtest.h>
+#include <stdexcept>
+
+using namespace WeldTrackApp;
+
+TEST(RingBufferTest, PushPopWrapAround) {
+    RingBuffer<int, 4> buf;
+    EXPECT_TRUE(buf.Empty());
+    EXPECT_EQ(buf.Capacity(), 4u);
+
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_TRUE(buf.Push(i));
+    }
+    EXPECT_TRUE(buf.Full());
+    EXPECT_FALSE(buf.Push(4));  // 已满不压入
+
+    buf.PopFront(2);
+    EXPECT_TRUE(buf.Push(4));
+    EXPECT_TRUE(buf.Push(5));
+    ASSERT_EQ(buf.Size(), 4u);
+    for (size_t i = 0; i < buf.Size(); ++i) {
+        EXPECT_EQ(buf[i], static_cast<int>(i) + 2);
+    }
+    EXPECT_EQ(buf.Front(), 2);
+    EXPECT_EQ(buf.Back(), 5);
+}
+
+TEST(RingBufferTest, OverwriteOldest) {
+    RingBuffer<int, 3> buf;
+    for (int i = 0; i < 7; ++i) {
+        buf.PushOverwrite(i);
+    }
+    ASSERT_EQ(buf.Size(), 3u);
+    EXPECT_EQ(buf[0], 4);
+    EXPECT_EQ(buf[2], 6);
+
+    buf.Clear();
+    EXPECT_TRUE(buf.Empty());
+    EXPECT_THROW(buf.PopFront(), std::out_of_range);
+    EXPECT_THROW(buf[0], std::out_of_range);
+}
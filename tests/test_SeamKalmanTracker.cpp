@@ -0,0 +1,148 @@
+#include "RobotMethod/SeamKalmanTracker.h"
+#include "RobotMethod/SeamPosFilter.h"
+#include <gtest/gtest.h>
+#include <vector>
+#include <random>
+#include <cmath>
+#include <stdexcept>
+
+using namespace WeldTrackApp;
+
+// 匀速直线焊缝：CV 模型无稳态滞后，随机游走模型存在滞后
+TEST(SeamKalmanTrackerTest, CVTracksLineWithoutLag) {
+    const double dt = 0.01;
+    const double speed = 15.0;  // mm/s
+    SeamCVTracker tracker(dt, 10.0, 0.01);
+    SeamPosFilter legacy(0.1, 0.01);
+
+    std::vector<double> cvPt;
+    std::vector<double> rwPt;
+    for (int i = 0; i < 400; ++i) {
+        std::vector<double> pt = { speed * dt * i, 2.0, -1.0 };
+        cvPt = tracker.Update(pt);
+        rwPt = legacy.Update(pt);
+    }
+    const double truth = speed * dt * 399;
+    EXPECT_NEAR(cvPt[0], truth, 1e-3);
+    EXPECT_GT(std::fabs(rwPt[0] - truth), 10 * std::fabs(cvPt[0] - truth));
+
+    EXPECT_NEAR(tracker.GetVelocity()[0], speed, 1e-2);
+    EXPECT_NEAR(tracker.GetVelocity()[1], 0.0, 1e-6);
+
+    // 前视外推
+    auto ahead = tracker.Predict(0.5);
+    EXPECT_NEAR(ahead[0], truth + speed * 0.5, 1e-2);
+    EXPECT_NEAR(ahead[1], 2.0, 1e-6);
+    EXPECT_NEAR(ahead[2], -1.0, 1e-6);
+}
+
+// 匀加速弯曲焊缝：CA 模型可跟踪并外推二次曲线
+TEST(SeamKalmanTrackerTest, CATracksCurvedSeam) {
+    const double dt = 0.01;
+    SeamCATracker tracker(dt, 50.0, 0.01);
+    std::mt19937 rng(3);
+    std::normal_distribution<double> noise(0.0, 0.05);
+
+    auto curve = [](double t) { return 10.0 * t + 4.0 * t * t; };
+    for (int i = 0; i < 600; ++i) {
+        double t = dt * i;
+        tracker.Update({ t * 15.0, curve(t) + noise(rng), 0.0 });
+    }
+    double tEnd = dt * 599;
+    EXPECT_NEAR(tracker.GetFilterPt()[1], curve(tEnd), 0.1);
+    EXPECT_NEAR(tracker.Predict(0.2)[1], curve(tEnd + 0.2), 0.3);
+}
+
+// 以测量历史为输入（与 mea_Pos_Filter 的数据形式相同）
+TEST(SeamKalmanTrackerTest, MeaPosFilterInterface) {
+    SeamCVTracker tracker(0.01, 1.0, 0.1);
+    SeamCVTracker reference(0.01, 1.0, 0.1);
+
+    std::vector<std::vector<double>> history;
+    EXPECT_EQ(tracker.mea_Pos_Filter(history), std::vector<double>({ 0.0, 0.0, 0.0 }));
+
+    for (int i = 0; i < 20; ++i) {
+        history.push_back({ 0.1 * i, 1.0, 2.0 });
+        auto expect = reference.Update(history.back());
+        EXPECT_EQ(tracker.mea_Pos_Filter(history), expect);
+    }
+    EXPECT_EQ(tracker.Count(), 20u);
+
+    // 历史变短视为新焊缝
+    history.resize(1);
+    EXPECT_EQ(tracker.mea_Pos_Filter(history), history[0]);
+    EXPECT_EQ(tracker.Count(), 1u);
+}
+
+// 定长滑动窗口（调用方只保留最近的点）：每次只处理新进入窗口的点
+TEST(SeamKalmanTrackerTest, MeaPosFilterSlidingWindow) {
+    SeamCVTracker tracker(0.01, 1.0, 0.1);
+    SeamCVTracker reference(0.01, 1.0, 0.1);
+    const size_t window = 30;
+
+    std::vector<std::vector<double>> stream;
+    for (int i = 0; i < 300; ++i) {
+        stream.push_back({ 0.1 * i, std::sin(0.02 * i), 2.0 + 0.001 * i * i });
+    }
+
+    // 前段每次新增 1 个点，后段每次新增 3 个点
+    size_t end = 0;
+    while (end < stream.size()) {
+        const size_t step = (end < 150) ? 1 : 3;
+        std::vector<double> expect;
+        for (size_t k = 0; k < step && end < stream.size(); ++k, ++end) {
+            expect = reference.Update(stream[end]);
+        }
+        const size_t begin = (end > window) ? end - window : 0;
+        std::vector<std::vector<double>> history(stream.begin() + begin, stream.begin() + end);
+        ASSERT_EQ(tracker.mea_Pos_Filter(history), expect) << "end = " << end;
+    }
+    EXPECT_EQ(tracker.Count(), stream.size());
+
+    // 窗口内容不变：不重复处理
+    std::vector<std::vector<double>> history(stream.end() - window, stream.end());
+    EXPECT_EQ(tracker.mea_Pos_Filter(history), reference.GetFilterPt());
+    EXPECT_EQ(tracker.Count(), stream.size());
+}
+
+// 移动后停顿：重复的测量点仍逐点更新，速度估计衰减，不再外推不存在的运动
+TEST(SeamKalmanTrackerTest, MeaPosFilterDwell) {
+    const size_t window = 30;
+    for (bool sliding : { false, true }) {
+        SeamCVTracker tracker(0.01, 1.0, 0.1);
+        SeamCVTracker reference(0.01, 1.0, 0.1);
+
+        std::vector<std::vector<double>> stream;
+        for (int i = 0; i < 200; ++i) {
+            stream.push_back({ 0.15 * i, 1.0, 2.0 });
+        }
+        for (int i = 0; i < 400; ++i) {
+            stream.push_back(stream[199]);
+        }
+
+        double movingVel = 0.0;
+        for (size_t end = 1; end <= stream.size(); ++end) {
+            auto expect = reference.Update(stream[end - 1]);
+            const size_t begin = (sliding && end > window) ? end - window : 0;
+            std::vector<std::vector<double>> history(stream.begin() + begin, stream.begin() + end);
+            ASSERT_EQ(tracker.mea_Pos_Filter(history), expect) << "end = " << end;
+            if (end == 200) {
+                movingVel = tracker.GetVelocity()[0];
+            }
+        }
+        EXPECT_EQ(tracker.Count(), stream.size());
+        EXPECT_NEAR(movingVel, 15.0, 0.5);
+        EXPECT_LT(std::fabs(tracker.GetVelocity()[0]), 0.05 * movingVel);
+        EXPECT_NEAR(tracker.Predict(0.2)[0], stream.back()[0], 0.05);
+    }
+}
+
+TEST(SeamKalmanTrackerTest, InvalidParameters) {
+    EXPECT_THROW(SeamCVTracker(0.0, 1.0, 0.1), std::invalid_argument);
+    EXPECT_THROW(SeamCVTracker(0.01, -1.0, 0.1), std::invalid_argument);
+    EXPECT_THROW(SeamCATracker(0.01, 1.0, 0.0), std::invalid_argument);
+
+    SeamCVTracker tracker(0.01, 1.0, 0.1);
+    tracker.Update({ 1.0, 2.0 });  // 不足3维被忽略
+    EXPECT_EQ(tracker.Count(), 0u);
+}
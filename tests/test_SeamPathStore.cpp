@@ -0,0 +1,152 @@
+#include "RobotMethod/SeamPathStore.h"
+#include "RobotMethod/TrackAlgMethod.h"
+#include <gtest/gtest.h>
+#include <vector>
+#include <cmath>
+#include <stdexcept>
+
+using namespace WeldTrackApp;
+
+// 总长度与 Cal_totalLength 一致（trackDatas_Save 行中位置位于第 5-7 个元素）
+TEST(SeamPathStoreTest, TotalLengthMatchesCalTotalLength) {
+    std::vector<std::vector<double>> trackDatas_Save;
+    SeamPathStore store(5);
+    TrackAlgMethod alg;
+
+    for (int i = 0; i < 200; ++i) {
+        double t = 0.1 * i;
+        std::vector<double> row(9, 0.0);
+        row[5] = 10.0 * t;
+        row[6] = std::sin(t);
+        row[7] = 0.5 * t;
+        trackDatas_Save.push_back(row);
+        store.Append(row);
+        EXPECT_NEAR(store.TotalLength(), alg.Cal_totalLength(trackDatas_Save), 1e-9);
+    }
+    EXPECT_EQ(store.Size(), 200u);
+
+    EXPECT_THROW(store.Append({ 0.0, 0.0, 0.0 }), std::invalid_argument);
+}
+
+// 按弧长取点：线性插值，超出范围取端点
+TEST(SeamPathStoreTest, PointAtDistance) {
+    SeamPathStore store;
+    EXPECT_THROW(store.PointAt(0.0), std::out_of_range);
+
+    store.AppendPoint(SeamPathStore::Point3d{ 0.0, 0.0, 0.0 });
+    store.AppendPoint(SeamPathStore::Point3d{ 3.0, 4.0, 0.0 });   // 5
+    store.AppendPoint(SeamPathStore::Point3d{ 3.0, 4.0, 10.0 });  // 15
+
+    EXPECT_DOUBLE_EQ(store.TotalLength(), 15.0);
+    EXPECT_DOUBLE_EQ(store.ArcLength(1), 5.0);
+
+    auto pt = store.PointAt(2.5);
+    EXPECT_DOUBLE_EQ(pt[0], 1.5);
+    EXPECT_DOUBLE_EQ(pt[1], 2.0);
+    pt = store.PointAt(10.0);
+    EXPECT_DOUBLE_EQ(pt[2], 5.0);
+    EXPECT_EQ(store.PointAt(-1.0), store[0]);
+    EXPECT_EQ(store.PointAt(100.0), store[2]);
+}
+
+// 最近点：沿焊缝推进时从上次结果出发搜索
+TEST(SeamPathStoreTest, NearestPointAlongSeam) {
+    SeamPathStore store;
+    for (int i = 0; i <= 100; ++i) {
+        store.AppendPoint(SeamPathStore::Point3d{ 1.0 * i, 0.0, 0.0 });
+    }
+    EXPECT_EQ(store.NearestIndex({ 10.2, 1.0, 0.0 }), 10u);
+    EXPECT_EQ(store.NearestIndex({ 57.6, -0.5, 0.0 }), 58u);
+    EXPECT_EQ(store.NearestIndex({ 3.4, 0.0, 2.0 }), 3u);
+    EXPECT_EQ(store.NearestIndex({ 500.0, 0.0, 0.0 }, 0), 100u);
+}
+
+// U 形焊缝：首次查询与跳变时局部搜索停在另一侧的局部极小值，网格索引给出全局最近点
+TEST(SeamPathStoreTest, NearestPointOnUShapedSeam) {
+    const double PI = 3.14159265358979323846;
+    SeamPathStore store;
+    std::vector<SeamPathStore::Point3d> pts;
+    for (int i = 0; i <= 200; ++i) {
+        pts.push_back({ 0.5 * i, 0.0, 0.0 });                      // 去程 y = 0
+    }
+    for (int i = 1; i < 20; ++i) {
+        const double a = PI * i / 20;
+        pts.push_back({ 100.0 + 5.0 * std::sin(a), 5.0 - 5.0 * std::cos(a), 0.0 });  // 半圆
+    }
+    for (int i = 0; i <= 200; ++i) {
+        pts.push_back({ 100.0 - 0.5 * i, 10.0, 0.0 });             // 回程 y = 10
+    }
+    for (const auto& pt : pts) {
+        store.AppendPoint(pt);
+    }
+
+    const auto brute = [&](const SeamPathStore::Point3d& q) {
+        size_t best = 0;
+        double bestD = HUGE_VAL;
+        for (size_t k = 0; k < pts.size(); ++k) {
+            const double d = std::hypot(pts[k][0] - q[0], pts[k][1] - q[1], pts[k][2] - q[2]);
+            if (d < bestD) {
+                bestD = d;
+                best = k;
+            }
+        }
+        return best;
+    };
+
+    // 首次查询：从下标 0 出发会停在去程上
+    const SeamPathStore::Point3d cold = { 20.1, 9.0, 0.0 };
+    EXPECT_EQ(store.NearestIndex(cold), brute(cold));
+    EXPECT_NEAR(store[store.NearestIndex(cold)][1], 10.0, 1e-12);
+
+    // 沿回程推进后跳回去程附近
+    for (double x = 90.0; x > 30.0; x -= 0.7) {
+        const SeamPathStore::Point3d q = { x, 9.6, 0.3 };
+        ASSERT_EQ(store.NearestIndex(q), brute(q)) << "x = " << x;
+    }
+    const SeamPathStore::Point3d jump = { 60.2, 0.4, 0.0 };
+    EXPECT_EQ(store.NearestIndex(jump), brute(jump));
+    EXPECT_EQ(store.NearestIndex(jump, 300), brute(jump));
+
+    // 远离路径的查询（网格过多时逐点比较）
+    const SeamPathStore::Point3d far = { -400.0, 500.0, 80.0 };
+    EXPECT_EQ(store.NearestIndex(far), brute(far));
+
+    // 裁剪后不返回已裁剪的点
+    store.TrimBefore(60.0);
+    const SeamPathStore::Point3d trimmed = { 10.0, 0.5, 0.0 };
+    EXPECT_NEAR(store[store.NearestIndex(trimmed)][1], 10.0, 1e-12);
+    store.TrimBefore(150.0);
+    EXPECT_NEAR(store[store.NearestIndex(trimmed)][1], 10.0, 1e-12);
+}
+
+// 裁剪旧数据后弧长保持自焊缝起点计算
+TEST(SeamPathStoreTest, TrimKeepsAbsoluteArcLength) {
+    SeamPathStore store;
+    for (int i = 0; i <= 100; ++i) {
+        store.AppendPoint(SeamPathStore::Point3d{ 0.0, 1.0 * i, 0.0 });
+    }
+    EXPECT_EQ(store.NearestIndex({ 0.0, 80.0, 0.0 }), 80u);
+
+    EXPECT_EQ(store.TrimBefore(30.5), 30u);
+    EXPECT_EQ(store.Size(), 71u);
+    EXPECT_DOUBLE_EQ(store.StartLength(), 30.0);
+    EXPECT_DOUBLE_EQ(store.TotalLength(), 100.0);
+    EXPECT_DOUBLE_EQ(store.PointAt(30.5)[1], 30.5);
+    EXPECT_EQ(store.NearestIndex({ 0.0, 81.0, 0.0 }), 51u);
+
+    // 超过一半时整体搬移，结果不变
+    EXPECT_EQ(store.TrimBefore(90.0), 60u);
+    EXPECT_EQ(store.Size(), 11u);
+    EXPECT_DOUBLE_EQ(store.ArcLength(0), 90.0);
+    EXPECT_DOUBLE_EQ(store[10][1], 100.0);
+
+    // 至少保留最后一个点
+    EXPECT_EQ(store.TrimBefore(1000.0), 10u);
+    EXPECT_EQ(store.Size(), 1u);
+    EXPECT_EQ(store.TrimBefore(1000.0), 0u);
+
+    store.AppendPoint(SeamPathStore::Point3d{ 0.0, 101.0, 0.0 });
+    EXPECT_DOUBLE_EQ(store.TotalLength(), 101.0);
+
+    EXPECT_THROW(store[5], std::out_of_range);
+}
@@ -0,0 +1,53 @@
+#include "RobotMethod/SeamPosFilter.h"
+#include "RobotMethod/TrackAlgMethod.h"
+#include <gtest/gtest.h>
+#include <vector>
+#include <random>
+#include <cstring>
+
+using namespace WeldTrackApp;
+
+// 逐位比较两个点
+static bool BitEqual(const std::vector<double>& a, const std::vector<double>& b) {
+    return a.size() == b.size() && std::memcmp(a.data(), b.data(), a.size() * sizeof(double)) == 0;
+}
+
+// 与批量滤波逐位一致（覆盖补点阶段、增益未收敛阶段与超过 filterDelay 的阶段）
+TEST(SeamPosFilterTest, MatchesBatchFilterBitwise) {
+    const double covs[][2] = { {0.1, 0.01}, {1.0, 0.001}, {0.01, 0.1}, {5.0, 1e-5} };
+    std::mt19937 rng(7);
+    std::normal_distribution<double> noise(0.0, 0.2);
+
+    for (const auto& cov : covs) {
+        TrackAlgMethod alg;
+        SeamPosFilter filter(cov[0], cov[1]);
+        std::vector<std::vector<double>> history;
+
+        for (int i = 0; i < MacroDefine::filterDelay + 60; ++i) {
+            std::vector<double> pt = { 100.0 + 0.15 * i + noise(rng), -20.0 + noise(rng), 5.0 + noise(rng) };
+            history.push_back(pt);
+
+            auto expect = alg.mea_Pos_Filter(history, cov[0], cov[1]);
+            auto actual = filter.Update(pt);
+            ASSERT_TRUE(BitEqual(expect, actual)) << "sample " << i << " cov " << cov[0] << "/" << cov[1];
+        }
+        EXPECT_EQ(filter.Count(), history.size());
+    }
+}
+
+TEST(SeamPosFilterTest, EmptyAndInvalidInput) {
+    SeamPosFilter filter(0.1, 0.01);
+    EXPECT_EQ(filter.GetFilterPt(), std::vector<double>({ 0.0, 0.0, 0.0 }));
+
+    // 不足3维的点被忽略
+    filter.Update({ 1.0, 2.0 });
+    EXPECT_EQ(filter.Count(), 0u);
+
+    auto first = filter.Update({ 1.0, 2.0, 3.0 });
+    EXPECT_EQ(first, std::vector<double>({ 1.0, 2.0, 3.0 }));
+
+    filter.Update({ 2.0, 3.0, 4.0 });
+    filter.Reset();
+    EXPECT_EQ(filter.Count(), 0u);
+    EXPECT_EQ(filter.GetFilterPt(), std::vector<double>({ 0.0, 0.0, 0.0 }));
+}
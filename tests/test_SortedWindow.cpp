@@ -0,0 +1,72 @@
+#include "RobotMethod/SortedWindow.h"
+#include <gtest/gtest.h>
+#include <vector>
+#include <deque>
+#include <random>
+#include <cmath>
+#include <algorithm>
+#include <stdexcept>
+
+using namespace WeldTrackApp;
+
+namespace {
+    double BruteMedian(std::vector<double> v)
+    {
+        std::sort(v.begin(), v.end());
+        size_t mid = v.size() / 2;
+        return (v.size() % 2) ? v[mid] : (v[mid - 1] + v[mid]) / 2;
+    }
+
+    // 逐个加入随机值（含重复值），与直接排序计算的中位数/MAD 比较
+    template <size_t N>
+    void CheckAgainstBruteForce(SortedWindow<N>& window, unsigned seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_int_distribution<int> dist(-50, 50);
+        std::deque<double> recent;
+
+        for (int i = 0; i < 500; ++i) {
+            const double x = dist(rng) * 0.1;
+            window.Push(x);
+            recent.push_back(x);
+            if (recent.size() > window.Capacity()) {
+                recent.pop_front();
+            }
+            ASSERT_EQ(window.Size(), recent.size());
+
+            std::vector<double> v(recent.begin(), recent.end());
+            const double median = BruteMedian(v);
+            std::vector<double> dev;
+            for (double y : v) {
+                dev.push_back(std::fabs(y - median));
+            }
+            EXPECT_DOUBLE_EQ(window.Median(), median);
+            EXPECT_NEAR(window.MedianAbsDev(median), BruteMedian(dev), 1e-12);
+        }
+    }
+}
+
+TEST(SortedWindowTest, DynamicMatchesBruteForce) {
+    SortedWindow<> odd(9);
+    CheckAgainstBruteForce(odd, 1);
+    SortedWindow<> even(10);
+    CheckAgainstBruteForce(even, 2);
+}
+
+TEST(SortedWindowTest, FixedMatchesBruteForce) {
+    SortedWindow<7> odd;
+    CheckAgainstBruteForce(odd, 3);
+    SortedWindow<4> even;
+    CheckAgainstBruteForce(even, 4);
+
+    // 清空后重新填充
+    odd.Clear();
+    EXPECT_EQ(odd.Size(), 0u);
+    odd.Push(2.0);
+    EXPECT_DOUBLE_EQ(odd.Median(), 2.0);
+}
+
+TEST(SortedWindowTest, InvalidCapacity) {
+    EXPECT_THROW(SortedWindow<>(0), std::invalid_argument);
+    EXPECT_THROW(SortedWindow<5>(4), std::invalid_argument);
+}
@@ -0,0 +1,65 @@
+#include "RobotMethod/SpeedProfile.h"
+#include <gtest/gtest.h>
+#include <cmath>
+#include <stdexcept>
+
+using namespace WeldTrackApp;
+
+TEST(SpeedProfileTest, ConstantByDefault) {
+    SpeedProfile profile;
+    EXPECT_DOUBLE_EQ(profile.SpeedAt(0.0), MacroDefine::WeldSpeed);
+    EXPECT_DOUBLE_EQ(profile.SpeedAt(1e6), MacroDefine::WeldSpeed);
+    EXPECT_DOUBLE_EQ(profile.MaxAcc(), MacroDefine::WeldMaxAcc);
+    EXPECT_EQ(profile.Size(), 1u);
+}
+
+// 降速在低速区起点前完成，升速在高速区起点后开始
+TEST(SpeedProfileTest, RampsBetweenZones) {
+    SpeedProfile profile(20.0, 100.0);
+    profile.SetSpeedRange(50.0, 80.0, 10.0);
+
+    const double ramp = profile.RampDistance(20.0, 10.0);  // (400 - 100) / 200 = 1.5
+    EXPECT_DOUBLE_EQ(ramp, 1.5);
+
+    EXPECT_DOUBLE_EQ(profile.SpeedAt(50.0 - ramp - 0.1), 20.0);
+    EXPECT_NEAR(profile.SpeedAt(50.0 - ramp / 2), std::sqrt(100.0 + 100.0 * ramp), 1e-12);
+    EXPECT_DOUBLE_EQ(profile.SpeedAt(50.0), 10.0);
+    EXPECT_DOUBLE_EQ(profile.SpeedAt(79.9), 10.0);
+    EXPECT_NEAR(profile.SpeedAt(80.5), std::sqrt(100.0 + 100.0), 1e-12);
+    EXPECT_DOUBLE_EQ(profile.SpeedAt(80.0 + ramp + 0.1), 20.0);
+
+    EXPECT_DOUBLE_EQ(profile.TargetAt(49.0), 20.0);
+    EXPECT_DOUBLE_EQ(profile.TargetAt(50.0), 10.0);
+    EXPECT_DOUBLE_EQ(profile.MaxSpeedFrom(60.0), 20.0);
+
+    // 速度曲线连续，v^2 对弧长的斜率不超过 2a
+    double prev = profile.SpeedAt(0.0);
+    for (double s = 0.01; s < 100.0; s += 0.01) {
+        double v = profile.SpeedAt(s);
+        EXPECT_LE(std::fabs(v * v - prev * prev), 2 * 100.0 * 0.01 + 1e-9);
+        prev = v;
+    }
+}
+
+// 短高速区达不到设定速度时取三角形速度曲线
+TEST(SpeedProfileTest, ShortZoneAndOverride) {
+    SpeedProfile profile(10.0, 100.0);
+    profile.SetSpeedRange(10.0, 10.5, 40.0);
+    EXPECT_LT(profile.SpeedAt(10.25), 40.0);
+    EXPECT_NEAR(profile.SpeedAt(10.25), std::sqrt(100.0 + 2 * 100.0 * 0.25), 1e-12);
+
+    // SetSpeed 清除其后的分段
+    profile.SetSpeed(5.0, 12.0);
+    EXPECT_EQ(profile.Size(), 2u);
+    EXPECT_DOUBLE_EQ(profile.SpeedAt(10.25), 12.0);
+    EXPECT_DOUBLE_EQ(profile.MaxSpeedFrom(0.0), 12.0);
+}
+
+TEST(SpeedProfileTest, InvalidInput) {
+    EXPECT_THROW(SpeedProfile(0.0), std::invalid_argument);
+    EXPECT_THROW(SpeedProfile(10.0, 0.0), std::invalid_argument);
+
+    SpeedProfile profile;
+    EXPECT_THROW(profile.SetSpeed(1.0, -1.0), std::invalid_argument);
+    EXPECT_THROW(profile.SetSpeedRange(2.0, 1.0, 10.0), std::invalid_argument);
+}
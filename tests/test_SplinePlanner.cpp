@@ -0,0 +1,232 @@
+#include "RobotMethod/SplinePlanner.h"
+#include <gtest/gtest.h>
+#include <vector>
+#include <array>
+#include <cmath>
+#include <algorithm>
+#include <stdexcept>
+
+using namespace WeldTrackApp;
+
+namespace {
+    // 由增量序列计算每周期的速度 (mm/s)
+    std::vector<double> CycleSpeeds(const std::vector<IncPt>& incs)
+    {
+        std::vector<double> speeds;
+        for (const auto& inc : incs) {
+            double len = std::sqrt(static_cast<double>(inc.d[0]) * inc.d[0] +
+                static_cast<double>(inc.d[1]) * inc.d[1] +
+                static_cast<double>(inc.d[2]) * inc.d[2]) / 1000.0;
+            speeds.push_back(len / MacroDefine::InterCycle);
+        }
+        return speeds;
+    }
+
+    long long Sum(const std::vector<IncPt>& incs, int axis)
+    {
+        long long sum = 0;
+        for (const auto& inc : incs) {
+            sum += inc.d[axis];
+        }
+        return sum;
+    }
+}
+
+// 直线焊缝：精确停在末点，姿态增量总和与总长成比例
+TEST(SplinePlannerTest, StraightLineLandsOnEndPoint) {
+    SplinePlanner planner(100.0, { 1.0, -2.0, 0.5 });
+    std::vector<IncPt> incs;
+
+    for (int i = 0; i <= 100; ++i) {
+        planner.PushPoint({ 0.5 * i, 10.0, -3.0 }, incs);
+    }
+    EXPECT_GT(planner.RemainLength(), 0.0);
+    planner.Finish(incs);
+
+    EXPECT_EQ(Sum(incs, 0), 50000);
+    EXPECT_EQ(Sum(incs, 1), 0);
+    EXPECT_EQ(Sum(incs, 2), 0);
+    EXPECT_EQ(Sum(incs, 3), 5000);
+    EXPECT_EQ(Sum(incs, 4), -10000);
+    EXPECT_EQ(Sum(incs, 5), 2500);
+    EXPECT_NEAR(planner.PlannedLength(), 50.0, 1e-9);
+    EXPECT_DOUBLE_EQ(planner.CurSpeed(), 0.0);
+    EXPECT_NEAR(planner.CurPos()[0], 50.0, 1e-9);
+}
+
+// 速度不超过设定值，相邻周期速度变化不超过加速度限制
+TEST(SplinePlannerTest, SpeedAndAccelerationLimits) {
+    const double speed = 30.0;
+    const double acc = 200.0;
+    SplinePlanner planner(500.0, {}, speed, acc);
+    std::vector<IncPt> incs;
+
+    for (int i = 0; i <= 200; ++i) {
+        planner.PushPoint({ 1.0 * i, 0.0, 0.0 }, incs);
+    }
+    planner.Finish(incs);
+
+    auto speeds = CycleSpeeds(incs);
+    ASSERT_GT(speeds.size(), 2u);
+    const double quant = 0.001 / MacroDefine::InterCycle;  // 量化引起的速度误差
+    const double dv = acc * MacroDefine::InterCycle;
+    double prev = 0.0;
+    double peak = 0.0;
+    for (size_t i = 0; i + 1 < speeds.size(); ++i) {
+        EXPECT_LE(speeds[i], speed + quant);
+        EXPECT_LE(std::fabs(speeds[i] - prev), dv + 2 * quant);
+        prev = speeds[i];
+        peak = std::max(peak, speeds[i]);
+    }
+    EXPECT_NEAR(peak, speed, quant);
+    // 最后一个周期走完不足一个减速步长的剩余路径
+    EXPECT_LE(speeds.back(), dv + quant);
+    EXPECT_EQ(Sum(incs, 0), 200000);
+}
+
+// 直角拐角：样条平滑过渡，路径不再出现速度方向的突变
+TEST(SplinePlannerTest, CornerIsSmoothed) {
+    SplinePlanner planner(200.0, {});
+    std::vector<IncPt> incs;
+
+    for (int i = 0; i <= 20; ++i) {
+        planner.PushPoint({ 1.0 * i, 0.0, 0.0 }, incs);
+    }
+    for (int i = 1; i <= 20; ++i) {
+        planner.PushPoint({ 20.0, 1.0 * i, 0.0 }, incs);
+    }
+    planner.Finish(incs);
+
+    EXPECT_EQ(Sum(incs, 0), 20000);
+    EXPECT_EQ(Sum(incs, 1), 20000);
+
+    // 相邻周期的方向夹角保持很小
+    for (size_t i = 1; i < incs.size(); ++i) {
+        const IncPt& a = incs[i - 1];
+        const IncPt& b = incs[i];
+        double la = std::hypot(a.d[0], a.d[1]);
+        double lb = std::hypot(b.d[0], b.d[1]);
+        if (la < 20 || lb < 20) {
+            continue;  // 起停阶段增量过小，方向受量化影响
+        }
+        double cosAng = (static_cast<double>(a.d[0]) * b.d[0] + static_cast<double>(a.d[1]) * b.d[1]) / (la * lb);
+        EXPECT_GT(cosAng, std::cos(15.0 * M_PI / 180.0));
+    }
+
+    // 拐角处按曲率降速，合成加速度受限；直线段恢复设定速度
+    auto speeds = CycleSpeeds(incs);
+    double minSpeed = MacroDefine::WeldSpeed;
+    for (size_t i = speeds.size() / 4; i < speeds.size() * 3 / 4; ++i) {
+        minSpeed = std::min(minSpeed, speeds[i]);
+    }
+    EXPECT_LT(minSpeed, MacroDefine::WeldSpeed * 0.8);
+    EXPECT_NEAR(speeds[speeds.size() / 8], MacroDefine::WeldSpeed, 0.2);
+
+    const double dt = MacroDefine::InterCycle;
+    for (size_t i = 1; i < incs.size(); ++i) {
+        double ax = (incs[i].d[0] - incs[i - 1].d[0]) / 1000.0 / (dt * dt);
+        double ay = (incs[i].d[1] - incs[i - 1].d[1]) / 1000.0 / (dt * dt);
+        // 切向与法向各不超过 WeldMaxAcc，另加量化误差
+        EXPECT_LT(std::hypot(ax, ay), std::sqrt(2.0) * MacroDefine::WeldMaxAcc + 30.0);
+    }
+}
+
+// 样条经过每个控制点：拐角与弯曲处焊枪路径不再切角
+TEST(SplinePlannerTest, PassesThroughControlPoints) {
+    for (size_t num : { 3u, 40u }) {
+        std::vector<std::vector<double>> pts;
+        for (size_t i = 0; i < num; ++i) {
+            // 直角拐角后接正弦弯曲
+            const double t = static_cast<double>(i);
+            pts.push_back(i < num / 2 ? std::vector<double>{ 2.0 * t, 0.0, 0.1 * t }
+                                      : std::vector<double>{ 2.0 * (num / 2), 2.0 * (t - num / 2) + 1e-3,
+                                                             0.1 * t + std::sin(t) });
+        }
+
+        SplinePlanner planner(500.0, {});
+        std::vector<IncPt> incs;
+        for (const auto& pt : pts) {
+            planner.PushPoint(pt, incs);
+        }
+        planner.Finish(incs);
+
+        // 由增量累加得到每周期的指令位置
+        std::vector<std::array<double, 3>> path = { { pts[0][0], pts[0][1], pts[0][2] } };
+        long long acc[3] = { 0, 0, 0 };
+        for (const auto& inc : incs) {
+            for (int i = 0; i < 3; ++i) {
+                acc[i] += inc.d[i];
+            }
+            path.push_back({ pts[0][0] + acc[0] / 1000.0, pts[0][1] + acc[1] / 1000.0, pts[0][2] + acc[2] / 1000.0 });
+        }
+
+        // 控制点到指令路径（折线）的距离：量化与弦高误差之内
+        for (const auto& q : pts) {
+            double best = HUGE_VAL;
+            for (size_t k = 1; k < path.size(); ++k) {
+                double ab[3], aq[3], ab2 = 0.0, dot = 0.0;
+                for (int i = 0; i < 3; ++i) {
+                    ab[i] = path[k][i] - path[k - 1][i];
+                    aq[i] = q[i] - path[k - 1][i];
+                    ab2 += ab[i] * ab[i];
+                    dot += ab[i] * aq[i];
+                }
+                const double u = (ab2 > 0.0) ? std::min(std::max(dot / ab2, 0.0), 1.0) : 0.0;
+                double d2 = 0.0;
+                for (int i = 0; i < 3; ++i) {
+                    d2 += (aq[i] - u * ab[i]) * (aq[i] - u * ab[i]);
+                }
+                best = std::min(best, std::sqrt(d2));
+            }
+            EXPECT_LT(best, 0.005) << "num = " << num << ", pt = (" << q[0] << ", " << q[1] << ", " << q[2] << ")";
+        }
+        EXPECT_NEAR(planner.CurPos()[0], pts.back()[0], 1e-3);
+        EXPECT_NEAR(planner.CurPos()[1], pts.back()[1], 1e-3);
+        EXPECT_NEAR(planner.CurPos()[2], pts.back()[2], 1e-3);
+    }
+}
+
+// 速度曲线：进入低速区前完成降速，离开后恢复
+TEST(SplinePlannerTest, FollowsSpeedProfile) {
+    SplinePlanner planner(500.0, {}, 30.0, 200.0);
+    SpeedProfile profile(30.0, 200.0);
+    profile.SetSpeedRange(40.0, 60.0, 10.0);
+    planner.SetSpeedProfile(profile);
+
+    std::vector<IncPt> incs;
+    double pos = 0.0;
+    const double quant = 0.001 / MacroDefine::InterCycle;
+    for (int i = 0; i <= 100; ++i) {
+        size_t before = incs.size();
+        planner.PushPoint({ 1.0 * i, 0.0, 0.0 }, incs);
+        for (size_t k = before; k < incs.size(); ++k) {
+            pos += incs[k].d[0] / 1000.0;
+            double v = incs[k].d[0] / 1000.0 / MacroDefine::InterCycle;
+            if (pos > 40.0 + 0.1 && pos < 60.0) {
+                EXPECT_LE(v, 10.0 + 2 * quant);
+            }
+        }
+    }
+    planner.Finish(incs);
+    EXPECT_EQ(Sum(incs, 0), 100000);
+
+    auto speeds = CycleSpeeds(incs);
+    EXPECT_NEAR(*std::max_element(speeds.begin(), speeds.end()), 30.0, quant);
+}
+
+TEST(SplinePlannerTest, InvalidInput) {
+    EXPECT_THROW(SplinePlanner(0.0, {}), std::invalid_argument);
+    EXPECT_THROW(SplinePlanner(10.0, {}, 0.0), std::invalid_argument);
+    EXPECT_THROW(SplinePlanner(10.0, {}, 15.0, -1.0), std::invalid_argument);
+
+    SplinePlanner planner(10.0, {});
+    std::vector<IncPt> incs;
+    EXPECT_THROW(planner.PushPoint({ 1.0, 2.0 }, incs), std::invalid_argument);
+
+    // 只有一个点时不生成增量
+    planner.PushPoint({ 0.0, 0.0, 0.0 }, incs);
+    planner.PushPoint({ 0.01, 0.0, 0.0 }, incs);  // 距离过近被跳过
+    EXPECT_EQ(planner.Finish(incs), 0u);
+    EXPECT_TRUE(incs.empty());
+    EXPECT_THROW(planner.PushPoint({ 1.0, 0.0, 0.0 }, incs), std::logic_error);
+}
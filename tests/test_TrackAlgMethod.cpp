@@ -2,6 +2,7 @@
 #include <gtest/gtest.h>
 #include <vector>
 #include <cmath>
+#include <chrono>
 
 using namespace WeldTrackApp;
 
@@ -217,6 +218,21 @@ TEST_F(TrackAlgMethodTest, Gen_BatchTrackIncPtData_GeneratesCorrectBatch) {
     // 原始数据: 4点 → 移除前3点，保留最后1点
     EXPECT_EQ(trackData.size(), 1);
     EXPECT_EQ(trackData[0], originalData.back());
+
+    // 误差扩散：累计增量精确落在最后一点，Z轴按实际增量插补
+    alg.ResetResidual();
+    trackData = { {0.0, 0.0, 0.0}, {0.3337, -0.2171, 0.0913}, {0.6674, -0.4342, 0.1826} };
+    auto diffused = alg.Gen_BatchTrackIncPtData(trackData, 100.0, {90.0, 0.0, 0.0});
+    long long sum[3] = {0, 0, 0};
+    for (const auto& inc : diffused) {
+        for (int i = 0; i < 3; ++i) {
+            sum[i] += inc[i];
+        }
+    }
+    EXPECT_EQ(sum[0], 667);
+    EXPECT_EQ(sum[1], -434);
+    EXPECT_EQ(sum[2], 183);
+    EXPECT_NE(diffused[0][2], 0);
 }
 
 // 8. 测试测量位置滤波
@@ -285,3 +301,102 @@ TEST_F(TrackAlgMethodTest, BoundaryConditions) {
     EXPECT_NO_THROW(alg.Cal_WeldPara({p1, p2}, incAtt, totalLen));
 }
 
+// 11. 测试插补增量直接写入连续缓冲区
+TEST_F(TrackAlgMethodTest, IncPtBuffer_MatchesVectorOutput) {
+    std::vector<double> p1 = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+    std::vector<double> p2 = {1.5, -0.7, 0.3, 0.0, 0.0, 0.0};
+
+    std::vector<IncPt> incPts;
+    size_t count = alg.Cal_InterPt(p1, p2, 300.0, {90.0, -4.0, 2.0}, incPts);
+    auto expect = alg.Cal_InterPt(p1, p2, 300.0, {90.0, -4.0, 2.0});
+    ASSERT_EQ(count, expect.size());
+    ASSERT_EQ(incPts.size(), expect.size());
+    for (size_t i = 0; i < incPts.size(); ++i) {
+        EXPECT_EQ(std::vector<int>(incPts[i].d, incPts[i].d + 6), expect[i]);
+    }
+
+    // 追加写入，不覆盖已有数据
+    count = alg.Cal_InterPt(p1, p2, 300.0, {90.0, -4.0, 2.0}, incPts);
+    EXPECT_EQ(incPts.size(), 2 * count);
+
+    // 批量插补
+    auto trackData = long_trajectory;
+    auto trackDataCopy = long_trajectory;
+    std::vector<IncPt> batchPts;
+    alg.ResetResidual();
+    count = alg.Gen_BatchTrackIncPtData(trackData, 1e5, {1.0, 2.0, 3.0}, batchPts);
+    alg.ResetResidual();
+    auto batchExpect = alg.Gen_BatchTrackIncPtData(trackDataCopy, 1e5, {1.0, 2.0, 3.0});
+    ASSERT_EQ(count, batchExpect.size());
+    for (size_t i = 0; i < batchPts.size(); ++i) {
+        EXPECT_EQ(std::vector<int>(batchPts[i].d, batchPts[i].d + 6), batchExpect[i]);
+    }
+    EXPECT_EQ(trackData, trackDataCopy);
+}
+
+// 12. 测试误差扩散插补：余量跨段携带，累计增量精确落在目标上
+TEST_F(TrackAlgMethodTest, Cal_InterPt_ResidualLandsOnTarget) {
+    const double totalLen = 1000.0;
+    const std::vector<double> totalIncAtt = {30.0, -7.0, 1.0};
+
+    std::vector<std::vector<double>> pts;
+    for (int i = 0; i < 50; ++i) {
+        pts.push_back({0.3337 * i, -0.2171 * i, 0.0913 * i});
+    }
+
+    IncResidual residual = {};
+    std::vector<IncPt> incPts;
+    double lenSum = 0.0;
+    for (size_t i = 0; i + 1 < pts.size(); ++i) {
+        size_t count = alg.Cal_InterPt(pts[i], pts[i + 1], totalLen, totalIncAtt, residual, incPts);
+        EXPECT_GT(count, 0u);
+        lenSum += alg.Cal_Length(pts[i], pts[i + 1]);
+    }
+
+    long long sum[6] = {0, 0, 0, 0, 0, 0};
+    for (const auto& inc : incPts) {
+        for (int i = 0; i < 6; ++i) {
+            sum[i] += inc.d[i];
+        }
+    }
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_EQ(sum[i], std::llround((pts.back()[i] - pts[0][i]) * 1000));
+        EXPECT_LE(std::fabs(residual[i]), 0.5 + 1e-9);
+    }
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_EQ(sum[i + 3], std::llround(totalIncAtt[i] * lenSum / totalLen * 10000));
+    }
+    EXPECT_NE(incPts[0].d[2], 0);  // Z轴增量不再固定为0
+
+    // 旧算法截断后累计误差随段数增加
+    long long legacySum = 0;
+    for (size_t i = 0; i + 1 < pts.size(); ++i) {
+        for (const auto& inc : alg.Cal_InterPt(pts[i], pts[i + 1], totalLen, totalIncAtt)) {
+            legacySum += inc[0];
+        }
+    }
+    EXPECT_NE(legacySum, sum[0]);
+
+    // 距离过短：不生成插补点，余量不变
+    IncResidual before = residual;
+    EXPECT_EQ(alg.Cal_InterPt(pts[0], {0.01, 0.0, 0.0}, totalLen, totalIncAtt, residual, incPts), 0u);
+    EXPECT_EQ(residual, before);
+}
+
+// 13. 测试运行时焊接速度
+TEST_F(TrackAlgMethodTest, SetWeldSpeed_ChangesInterNum) {
+    EXPECT_DOUBLE_EQ(alg.GetWeldSpeed(), MacroDefine::WeldSpeed);
+
+    std::vector<double> p1 = {0.0, 0.0, 0.0};
+    std::vector<double> p2 = {3.0, 0.0, 0.0};
+    std::vector<IncPt> incPts;
+    EXPECT_EQ(alg.Cal_InterPt(p1, p2, 100.0, {0.0, 0.0, 0.0}, incPts), 20u);  // 3 / 0.15
+
+    alg.SetWeldSpeed(30.0);
+    incPts.clear();
+    EXPECT_EQ(alg.Cal_InterPt(p1, p2, 100.0, {0.0, 0.0, 0.0}, incPts), 10u);  // 3 / 0.3
+    EXPECT_FALSE(alg.Inter_Decision(p1, {0.2, 0.0, 0.0}));
+
+    EXPECT_THROW(alg.SetWeldSpeed(0.0), std::invalid_argument);
+    EXPECT_DOUBLE_EQ(alg.GetWeldSpeed(), 30.0);
+}
@@ -0,0 +1,123 @@
+#include "RobotMethod/TrackInterpolator.h"
+#include <gtest/gtest.h>
+#include <vector>
+#include <stdexcept>
+#include <cmath>
+#include <algorithm>
+
+using namespace WeldTrackApp;
+
+// 逐点输入与一次性批量插补的插补周期数一致，累计增量精确落在最后一个控制点
+TEST(TrackInterpolatorTest, MatchesBatchInterpolation) {
+    std::vector<std::vector<double>> trackData;
+    for (int i = 0; i < 200; ++i) {
+        // 每两个点中的第二个点距上一点仅 0.05mm（过近）
+        double x = 0.4 * (i / 2) + ((i % 2) ? 0.05 : 0.0);
+        trackData.push_back({ x, 0.01 * i, 0.003 * i });
+    }
+
+    TrackAlgMethod alg;
+    auto batchData = trackData;
+    auto expect = alg.Gen_BatchTrackIncPtData(batchData, 100.0, { 9.0, 0.0, -3.0 });
+
+    TrackInterpolator interp(100.0, { 9.0, 0.0, -3.0 });
+    std::vector<IncPt> actual;
+    size_t total = 0;
+    for (const auto& pt : trackData) {
+        total += interp.PushPoint(pt, actual);
+    }
+    EXPECT_EQ(total, actual.size());
+    ASSERT_EQ(actual.size(), expect.size());
+    EXPECT_GT(interp.DroppedPts(), 0u);
+
+    // 批量插补同样携带余量，增量逐个一致
+    for (size_t i = 0; i < actual.size(); ++i) {
+        EXPECT_EQ(std::vector<int>(actual[i].d, actual[i].d + 6), expect[i]) << "i = " << i;
+    }
+
+    // 最后一个被接受的控制点
+    const auto& lastPt = interp.CtrlPts().Back();
+    long long sum[6] = { 0, 0, 0, 0, 0, 0 };
+    for (const auto& inc : actual) {
+        for (int i = 0; i < 6; ++i) {
+            sum[i] += inc.d[i];
+        }
+    }
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_EQ(sum[i], std::llround((lastPt[i] - trackData[0][i]) * 1000));
+    }
+    EXPECT_NE(sum[2], 0);  // Z轴按实际增量插补
+}
+
+TEST(TrackInterpolatorTest, EmitsAsSoonAsFeasible) {
+    TrackInterpolator interp(100.0, { 90.0, 0.0, 0.0 });
+    std::vector<IncPt> incDatas;
+
+    EXPECT_EQ(interp.PushPoint({ 0.0, 0.0, 0.0 }, incDatas), 0u);   // 起点
+    EXPECT_EQ(interp.PushPoint({ 0.05, 0.0, 0.0 }, incDatas), 0u);  // 过近，跳过
+    EXPECT_EQ(interp.PushPoint({ 0.3, 0.0, 0.0 }, incDatas), 2u);   // 0.3 / 0.15 = 2
+    EXPECT_EQ(interp.PushPoint({ 0.6, 0.0, 0.0 }, incDatas), 2u);
+    EXPECT_EQ(incDatas.size(), 4u);
+
+    ASSERT_EQ(interp.CtrlPts().Size(), 3u);
+    EXPECT_DOUBLE_EQ(interp.CtrlPts().Back()[0], 0.6);
+    EXPECT_EQ(interp.DroppedPts(), 1u);
+}
+
+TEST(TrackInterpolatorTest, RingKeepsLatestCtrlPts) {
+    TrackInterpolator interp(1000.0, { 0.0, 0.0, 0.0 });
+    std::vector<IncPt> incDatas;
+    const size_t n = TrackInterpolator::CtrlPtCapacity + 10;
+    for (size_t i = 0; i < n; ++i) {
+        interp.PushPoint({ 0.3 * i, 0.0, 0.0 }, incDatas);
+    }
+    ASSERT_EQ(interp.CtrlPts().Size(), TrackInterpolator::CtrlPtCapacity);
+    EXPECT_DOUBLE_EQ(interp.CtrlPts().Front()[0], 0.3 * 10);
+    EXPECT_DOUBLE_EQ(interp.CtrlPts().Back()[0], 0.3 * (n - 1));
+}
+
+TEST(TrackInterpolatorTest, InvalidInput) {
+    EXPECT_THROW(TrackInterpolator(0.0, { 0.0, 0.0, 0.0 }), std::invalid_argument);
+
+    TrackInterpolator interp(100.0, { 0.0, 0.0, 0.0 });
+    std::vector<IncPt> incDatas;
+    EXPECT_THROW(interp.PushPoint({ 1.0, 2.0 }, incDatas), std::invalid_argument);
+}
+
+// 速度曲线：高速区段每周期步长增大，区段之间逐段过渡
+TEST(TrackInterpolatorTest, HonorsSpeedProfile) {
+    TrackInterpolator interp(1000.0, { 0.0, 0.0, 0.0 });
+    SpeedProfile profile(10.0, 20.0);
+    profile.SetSpeedRange(60.0, 200.0, 30.0);
+    interp.SetSpeedProfile(profile);
+
+    std::vector<IncPt> incDatas;
+    for (int i = 0; i <= 100; ++i) {
+        interp.PushPoint({ 3.0 * i, 0.0, 0.0 }, incDatas);
+    }
+    EXPECT_NEAR(interp.Travelled(), 300.0, 1e-9);
+
+    // 每周期步长 = 速度 * 10ms（单位 0.001 mm），段内步长不变，相邻段之间的速度变化受加速度限制
+    int prevStep = incDatas.front().d[0];
+    int maxStep = 0;
+    for (const auto& inc : incDatas) {
+        EXPECT_LE(std::abs(inc.d[0] - prevStep), 70);
+        prevStep = inc.d[0];
+        maxStep = std::max(maxStep, prevStep);
+    }
+    EXPECT_EQ(incDatas.front().d[0], 100);         // 10 mm/s
+    EXPECT_NEAR(maxStep, 300, 35);                 // 30 mm/s，每段插补点数取整
+    EXPECT_EQ(incDatas.back().d[0], 100);
+    EXPECT_LT(incDatas.size(), 3000u);             // 恒定 10 mm/s 时为 3000 个周期
+
+    long long sum = 0;
+    for (const auto& inc : incDatas) {
+        sum += inc.d[0];
+    }
+    EXPECT_EQ(sum, 300000);
+
+    // 焊接中降速：经过过渡距离后达到新速度
+    interp.SetWeldSpeed(5.0);
+    EXPECT_DOUBLE_EQ(interp.GetSpeedProfile().SpeedAt(interp.Travelled()), 10.0);
+    EXPECT_DOUBLE_EQ(interp.GetSpeedProfile().SpeedAt(interp.Travelled() + 1.875), 5.0);
+}
@@ -0,0 +1,195 @@
+#include "RobotMethod/TrackSimulator.h"
+#include "RobotMethod/LaserCoordToTcp.h"
+#include "RobotMethod/SeamPosFilter.h"
+#include "RobotMethod/FilterChain.h"
+#include "WorkStealingPool.h"
+#include <gtest/gtest.h>
+#include <vector>
+#include <string>
+#include <random>
+#include <cmath>
+#include <stdexcept>
+
+using namespace WeldTrackApp;
+
+// 焊缝特征点像素固定，法兰盘按焊接速度沿 x 移动，y 向按正弦偏移；pixelNoise 为像素噪声
+static SimRecording MakeRecording(size_t frameNum, double amplitude, double pixelNoise, unsigned seed) {
+	const double PI = 3.14159265358979323846;
+	LaserCoordToTcp converter;
+	std::mt19937 rng(seed);
+	std::normal_distribution<double> noise(0.0, pixelNoise);
+
+	SimRecording rec;
+	for (size_t i = 0; i < frameNum; ++i) {
+		double x = MacroDefine::WeldSpeed * MacroDefine::InterCycle * i;
+		double y = amplitude * std::sin(2 * PI * x / 200.0);
+		SimFrame frame;
+		frame.r = 480.0;
+		frame.c = 640.0;
+		frame.FLPPoint = { 800.0 + x, y, 300.0, 0.0, 0.0, 180.0 };
+
+		auto truth = converter.Cal_LaserMeaPtToBase(frame.r, frame.c, frame.FLPPoint);
+		rec.refPath.push_back({ truth[0], truth[1], truth[2] });
+
+		if (pixelNoise > 0) {
+			frame.r += noise(rng);
+			frame.c += noise(rng);
+		}
+		rec.frames.push_back(frame);
+	}
+	rec.totalLen = MacroDefine::WeldSpeed * MacroDefine::InterCycle * frameNum;
+	return rec;
+}
+
+// 直线焊缝：焊枪沿录制路径运动
+TEST(TrackSimulatorTest, StraightSeam) {
+	SimRecording rec = MakeRecording(2000, 0.0, 0.0, 1);
+	TrackSimulator sim;
+	SimResult result = sim.Run(rec);
+
+	EXPECT_EQ(result.frames, 2000u);
+	EXPECT_LT(result.maxErr, 0.05);
+	EXPECT_LE(result.maxQueue, sim.Config().queueCapacity);
+
+	// 焊枪走完滤波后的焊缝，每个插补周期至多执行一个增量
+	double seamLen = MacroDefine::WeldSpeed * MacroDefine::InterCycle * 1999;
+	EXPECT_NEAR(result.pathLength, seamLen, 1.0);
+	EXPECT_GE(result.simTime, 19.99);
+	EXPECT_LE(result.incCount + result.underruns, static_cast<size_t>(result.simTime / MacroDefine::InterCycle + 0.5));
+	// 实际耗时与机器负载有关，只记录不断言
+	RecordProperty("RealTimeFactor", std::to_string(result.RealTimeFactor()));
+	EXPECT_EQ(sim.Status(), TrackStatus::Track_null);
+}
+
+// 含噪声的弯曲焊缝：误差有界，无真值时以测量点为参考
+TEST(TrackSimulatorTest, NoisyCurvedSeam) {
+	SimRecording rec = MakeRecording(3000, 3.0, 0.5, 2);
+	TrackSimulator sim;
+	SimResult result = sim.Run(rec);
+	EXPECT_LT(result.maxErr, 1.0);
+	EXPECT_LT(result.rmsErr, result.maxErr);
+	EXPECT_GT(result.rmsErr, 0.0);
+
+	rec.refPath.clear();
+	SimResult measured = sim.Run(rec);
+	EXPECT_EQ(measured.incCount, result.incCount);
+	EXPECT_GT(measured.maxErr, 0.0);
+}
+
+// 飞溅造成的孤立离群点：启用 Hampel 预处理后不再传到焊枪
+TEST(TrackSimulatorTest, HampelRejectsSpikes) {
+	SimRecording rec = MakeRecording(2000, 2.0, 0.2, 5);
+	size_t spikes = 0;
+	for (size_t i = 100; i < rec.frames.size(); i += 37) {
+		rec.frames[i].c += (i % 2) ? 60.0 : -60.0;
+		++spikes;
+	}
+
+	SimResult plain = TrackSimulator().Run(rec);
+	EXPECT_EQ(plain.rejected, 0u);
+
+	SimConfig config;
+	config.hampelWindow = 15;
+	TrackSimulator sim(config);
+	SimResult result = sim.Run(rec);
+	EXPECT_GE(result.rejected, spikes);
+	EXPECT_LT(result.rejected, rec.frames.size() / 10);
+	EXPECT_LT(result.maxErr, plain.maxErr);
+	EXPECT_LT(result.rmsErr, plain.rmsErr);
+	// 离群点使焊枪来回摆动，路程变长
+	EXPECT_LT(result.pathLength, plain.pathLength);
+}
+
+// 指定滤波器：SeamPosFilter 与默认仿真一致，滤波链可直接替换
+TEST(TrackSimulatorTest, CustomFilter) {
+	SimRecording rec = MakeRecording(2000, 3.0, 0.5, 6);
+	TrackSimulator sim;
+	SimResult base = sim.Run(rec);
+
+	SeamPosFilter seamPos(sim.Config().MNoiseCov, sim.Config().PNoiseCov);
+	SimResult same = sim.Run(rec, seamPos);
+	EXPECT_EQ(same.incCount, base.incCount);
+	EXPECT_EQ(same.maxErr, base.maxErr);
+	EXPECT_EQ(same.rmsErr, base.rmsErr);
+
+	using namespace FilterPolicy;
+	using Chain = FilterChain<Median<5>, Kalman<CV>>;
+	AxisFilter<Chain> chain(
+		Chain(Median<5>(), Kalman<CV>(MacroDefine::InterCycle, 10.0, 0.1)),
+		Chain(Median<5>(), Kalman<CV>(MacroDefine::InterCycle, 10.0, 0.1)),
+		Chain(Median<5>(), Kalman<CV>(MacroDefine::InterCycle, 10.0, 0.1)));
+	SimResult custom = sim.Run(rec, chain);
+	EXPECT_EQ(custom.frames, base.frames);
+	EXPECT_GT(custom.incCount, 0u);
+	EXPECT_LT(custom.maxErr, 1.0);
+	EXPECT_GT(custom.rmsErr, 0.0);
+	EXPECT_EQ(sim.Status(), TrackStatus::Track_null);
+}
+
+// 通讯周期过长、单次下发不足时控制器队列断流，增量总数不变
+TEST(TrackSimulatorTest, QueueStarvation) {
+	SimRecording rec = MakeRecording(1000, 0.0, 0.0, 3);
+	SimConfig config;
+	config.commPeriod = 0.2;  // 每 0.2 s 只下发 10 个增量，控制器消耗 20 个
+	TrackSimulator sim(config);
+	SimResult result = sim.Run(rec);
+	SimResult normal = TrackSimulator().Run(rec);
+	EXPECT_EQ(result.incCount, normal.incCount);
+	EXPECT_GT(result.underruns, normal.underruns);
+	EXPECT_GT(result.simTime, normal.simTime);
+
+	// 队列容量不足以容纳一批时不再下发
+	config.commPeriod = MacroDefine::InterCycle;
+	config.queueCapacity = 20;
+	config.startQueue = 20;
+	TrackSimulator small(config);
+	SimResult limited = small.Run(rec);
+	EXPECT_LE(limited.maxQueue, 20u);
+	EXPECT_EQ(limited.incCount, normal.incCount);
+}
+
+// 并行批量仿真与逐个仿真结果一致
+TEST(TrackSimulatorTest, BatchMatchesSequential) {
+	std::vector<SimRecording> recs;
+	for (unsigned i = 0; i < 6; ++i) {
+		recs.push_back(MakeRecording(500 + 100 * i, 1.0 + i, 0.3, i));
+	}
+	WorkStealingPool pool(3);
+	SimConfig config;
+	auto batch = TrackSimulator::RunBatch(recs, config, pool);
+	ASSERT_EQ(batch.size(), recs.size());
+
+	TrackSimulator sim(config);
+	for (size_t i = 0; i < recs.size(); ++i) {
+		SimResult seq = sim.Run(recs[i]);
+		EXPECT_EQ(batch[i].incCount, seq.incCount);
+		EXPECT_EQ(batch[i].underruns, seq.underruns);
+		EXPECT_EQ(batch[i].maxErr, seq.maxErr);
+		EXPECT_EQ(batch[i].rmsErr, seq.rmsErr);
+		EXPECT_EQ(batch[i].simTime, seq.simTime);
+	}
+}
+
+TEST(TrackSimulatorTest, InvalidConfig) {
+	SimConfig config;
+	config.framePeriod = 0.0;
+	EXPECT_THROW(TrackSimulator{ config }, std::invalid_argument);
+
+	config = SimConfig();
+	config.queueCapacity = TrackSimulator::QueueMaxCapacity + 1;
+	EXPECT_THROW(TrackSimulator{ config }, std::invalid_argument);
+
+	config = SimConfig();
+	config.sendBatch = 0;
+	EXPECT_THROW(TrackSimulator{ config }, std::invalid_argument);
+
+	config = SimConfig();
+	config.hampelWindow = 2;
+	EXPECT_THROW(TrackSimulator{ config }, std::invalid_argument);
+
+	// 空录制数据
+	TrackSimulator sim;
+	SimResult result = sim.Run(SimRecording());
+	EXPECT_EQ(result.incCount, 0u);
+	EXPECT_EQ(result.frames, 0u);
+}
@@ -1,7 +1,17 @@
 #define _ITERATOR_DEBUG_LEVEL 0
 #include "TxtMethod/TxtMethod.h"
+#include "WorkStealingPool.h"
 #include <gtest/gtest.h>
 #include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <random>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <iomanip>
+#include <limits>
+#include <stdexcept>
 
 namespace fs = std::filesystem;
 
@@ -14,17 +24,17 @@ TEST(TxtMethodTest, ReadWriteIntegration) {
 //    TxtMethod txt;
 //    const std::string testFile = "test_data.txt";
 //
-//    // ׼
+//    // 准备测试数据
 //    std::vector<std::vector<double>> testData = {
 //        {123.456, 78.9, 0.123},
 //        {9999.99, -5.0, 3.14159}
 //    };
 //
-//    // дļ
+//    // 写入测试文件
 //    txt.WriteTxt(testData, testFile);
 //    ASSERT_TRUE(fs::exists(testFile));
 //
-//    // ȡ֤
+//    // 读取验证
 //    auto readData = txt.ReadData(testFile);
 //    ASSERT_EQ(readData.size(), testData.size());
 //
@@ -35,7 +45,7 @@ TEST(TxtMethodTest, ReadWriteIntegration) {
 //        EXPECT_NEAR(readData[i][2], testData[i][2], 0.01);
 //    }
 //
-//    // 
+//    // 清理
 //    fs::remove(testFile);
 //}
 //
@@ -43,17 +53,291 @@ TEST(TxtMethodTest, ReadWriteIntegration) {
 //    TxtMethod txt;
 //    const std::string testFile = "invalid_data.txt";
 //
-//    // Чݵļ
+//    // 创建包含无效数据的文件
 //    std::ofstream out(testFile);
 //    out << "1.0 2.0 valid\n";
-//    out << "3.0 invalid 5.0\n";  // Ӧ
+//    out << "3.0 invalid 5.0\n";  // 此行应被跳过
 //    out << "7.0 8.0 9.0\n";
 //    out.close();
 //
 //    auto data = txt.ReadData(testFile);
-//    ASSERT_EQ(data.size(), 2);  // ֻӦȡЧ
-//    EXPECT_EQ(data[0], std::vector<double>({ 1.0, 2.0, 0.0 })); // в0
+//    ASSERT_EQ(data.size(), 2);  // 只应读取两行有效数据
+//    EXPECT_EQ(data[0], std::vector<double>({ 1.0, 2.0, 0.0 })); // 第三列补0
 //    EXPECT_EQ(data[1], std::vector<double>({ 7.0, 8.0, 9.0 }));
 //
 //    fs::remove(testFile);
-//}
\ No newline at end of file
+//}
+// 原 istringstream + std::stod 实现，作为解析结果的参照
+static std::vector<std::vector<double>> ReferenceRead(const std::string& FileName) {
+	std::vector<std::vector<double>> result;
+	std::ifstream file(FileName);
+	std::string line;
+	while (std::getline(file, line)) {
+		std::istringstream iss(line);
+		std::vector<double> values;
+		std::string token;
+		while (iss >> token && values.size() < 3) {
+			try {
+				values.push_back(std::stod(token));
+			}
+			catch (...) {
+				values.clear();
+				break;
+			}
+		}
+		if (values.size() == 3) {
+			result.push_back(std::move(values));
+		}
+	}
+	return result;
+}
+
+static void ExpectSameRows(const std::vector<std::vector<double>>& a, const std::vector<std::vector<double>>& b) {
+	ASSERT_EQ(a.size(), b.size());
+	for (size_t i = 0; i < a.size(); ++i) {
+		ASSERT_EQ(a[i].size(), b[i].size()) << i;
+		for (size_t j = 0; j < a[i].size(); ++j) {
+			if (std::isnan(b[i][j])) {
+				EXPECT_TRUE(std::isnan(a[i][j])) << i;
+			}
+			else {
+				EXPECT_EQ(std::memcmp(&a[i][j], &b[i][j], sizeof(double)), 0) << i << " " << a[i][j] << " " << b[i][j];
+			}
+		}
+	}
+}
+
+// 快速解析与原实现逐位一致，含无效行、特殊格式与缓冲区边界
+TEST(TxtMethodTest, ReadDataMatchesReference) {
+	const std::string testFile = "read_reference.txt";
+	{
+		std::ofstream out(testFile, std::ios::binary);
+		out << "1.0 2.0 3.0\n";
+		out << "0123.46 0078.90 0000.12\n";
+		out << "00-5.00 -0005.00 9999.99\n";     // 负数格式化结果
+		out << "1.0 2.0\n";                       // 不足3个字段
+		out << "3.0 invalid 5.0\n";               // 无效字段
+		out << "1.0 2.0 3.0 invalid extra\n";     // 第4个字段不解析
+		out << "+1.5 0x10 1.5abc\n";              // 正号、十六进制、部分可解析
+		out << "1e-310 2 3\n";                    // 下溢
+		out << "1e400 2 3\n";                     // 上溢
+		out << "0e-400 0.000 -0.0\n";
+		out << "2.2250738585072014e-308 inf NAN\n";
+		out << "\t7.0\v8.0\f9.0\r\n";             // 各种空白与 CRLF
+		out << "\n   \n";
+		out << "0.1 0.2 0.30000000000000004\n";
+
+		std::mt19937 rng(3);
+		std::uniform_real_distribution<double> dist(-1e4, 1e4);
+		char buf[64];
+		for (int i = 0; i < 120000; ++i) {
+			for (int j = 0; j < 3; ++j) {
+				std::snprintf(buf, sizeof(buf), (i % 2) ? "%.17g" : "%.2f", dist(rng));
+				out << buf << (j < 2 ? " " : "");
+			}
+			if (i % 1000 == 0) {
+				out << " bad";
+			}
+			out << (i % 7 == 0 ? "\r\n" : "\n");
+		}
+		out << "4.0 5.0 6.0";  // 最后一行没有换行符
+	}
+
+	TxtMethod txt;
+	auto data = txt.ReadData(testFile);
+	auto expect = ReferenceRead(testFile);
+	EXPECT_GT(expect.size(), 120000u);
+	ExpectSameRows(data, expect);
+	fs::remove(testFile);
+
+	EXPECT_TRUE(txt.ReadData("not_exist_file.txt").empty());
+}
+
+// 按列定义读取：N 列、混合类型、与 ReadData 的跳过规则一致
+TEST(TxtMethodTest, ReadColumnsSchema) {
+	const std::string testFile = "read_columns.txt";
+	{
+		std::ofstream out(testFile, std::ios::binary);
+		out << "0 1 2 3 4 100.5 200.25 -3.0 extra\n";
+		out << "0 1 2 3 4 101.5 200.25\n";        // 不足8列
+		out << "0 1 2 3 4 102.5 bad -3.0\n";      // 无效字段
+		out << "9 9 9 9 9 103.5 201.25 -3.5";
+	}
+	TxtMethod txt;
+	ColumnTable table = txt.ReadColumns(testFile, ColumnSchema::TrackSave());
+	ASSERT_EQ(table.Rows(), 2u);
+	ASSERT_EQ(table.Cols(), 8u);
+	EXPECT_EQ(table.Float64("x"), std::vector<double>({ 100.5, 103.5 }));
+	EXPECT_EQ(table.Float64(6), std::vector<double>({ 200.25, 201.25 }));
+	EXPECT_DOUBLE_EQ(table.Value(1, 0), 9.0);
+	EXPECT_THROW(table.Int32("x"), std::invalid_argument);
+	EXPECT_THROW(table.Float64("w"), std::out_of_range);
+
+	// 行向量形式可直接用于 Cal_totalLength 等接口
+	auto rows = table.ToRows();
+	ASSERT_EQ(rows.size(), 2u);
+	EXPECT_EQ(rows[0], std::vector<double>({ 0, 1, 2, 3, 4, 100.5, 200.25, -3.0 }));
+
+	// 插补增量为 int32 列，小数不是有效的整数字段
+	{
+		std::ofstream out(testFile, std::ios::binary);
+		out << "150 -20 0 1 2 3\n";
+		out << "150 -20 0.5 1 2 3\n";
+		out << "-2147483648 2147483647 0 0 0 0\n";
+		out << "2147483648 0 0 0 0 0\n";          // 超出 int32
+	}
+	ColumnTable inc = txt.ReadColumns(testFile, ColumnSchema::IncData());
+	ASSERT_EQ(inc.Rows(), 2u);
+	EXPECT_EQ(inc.Int32("dx"), std::vector<int32_t>({ 150, -2147483648 }));
+	EXPECT_EQ(inc.Int32(1), std::vector<int32_t>({ -20, 2147483647 }));
+	EXPECT_DOUBLE_EQ(inc.Value(0, 5), 3.0);
+
+	// 自定义列定义
+	ColumnSchema schema{ { "t" }, { "count", ColumnType::Int32 } };
+	EXPECT_EQ(schema.IndexOf("count"), 1);
+	ColumnTable custom(schema);
+	custom.AppendRow({ 0.25, 7.0 });
+	EXPECT_EQ(custom.Int32("count")[0], 7);
+	EXPECT_THROW(custom.AppendRow({ 1.0 }), std::invalid_argument);
+	fs::remove(testFile);
+}
+
+// 3 列读取与 ReadData 结果一致
+TEST(TxtMethodTest, ReadColumnsMatchesReadData) {
+	const std::string testFile = "read_columns_3.txt";
+	{
+		std::ofstream out(testFile, std::ios::binary);
+		std::mt19937 rng(5);
+		std::uniform_real_distribution<double> dist(-1e3, 1e3);
+		for (int i = 0; i < 20000; ++i) {
+			out << dist(rng) << " " << dist(rng) << (i % 97 ? " " : " x") << dist(rng) << "\n";
+		}
+	}
+	TxtMethod txt;
+	auto rows = txt.ReadData(testFile);
+	ColumnTable table = txt.ReadColumns(testFile, ColumnSchema::Point3());
+	EXPECT_EQ(table.ToRows(), rows);
+	fs::remove(testFile);
+}
+
+// 原 ostringstream 实现，作为格式化结果的参照
+static std::string ReferenceFormat(double value, int precision) {
+	std::ostringstream oss;
+	oss << std::fixed << std::setprecision(precision)
+		<< std::setw(precision > 0 ? 5 + precision : 4) << std::setfill('0') << value;
+	return oss.str();
+}
+
+// 格式化与 ostringstream 逐字符一致，含负数、舍入边界、大数与特殊值
+TEST(TxtMethodTest, AppendDoubleMatchesStream) {
+	std::vector<double> values = { 0.0, -0.0, 5.0, -5.0, 0.005, 0.015, 0.125, -0.125, 2.675, 9999.995,
+		123.456, 78.9, 9999.99, 1e-300, 4.9e-324, 1e15, -1e22, 1.7976931348623157e308,
+		std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity(),
+		std::numeric_limits<double>::quiet_NaN() };
+	std::mt19937 rng(11);
+	std::uniform_real_distribution<double> small(-2e3, 2e3);
+	std::uniform_real_distribution<double> expo(-20.0, 20.0);
+	for (int i = 0; i < 20000; ++i) {
+		values.push_back(small(rng));
+		values.push_back((i % 2 ? -1.0 : 1.0) * std::pow(10.0, expo(rng)));
+	}
+
+	for (int precision : { 0, 1, 2, 3, 6, 17 }) {
+		std::string out;
+		for (double v : values) {
+			out.clear();
+			TxtMethod::AppendDouble(out, v, precision);
+			ASSERT_EQ(out, ReferenceFormat(v, precision)) << v << " p=" << precision;
+		}
+	}
+}
+
+// 写出的文本布局："0000.00"，负数的零补在符号前
+TEST(TxtMethodTest, WriteTxtLayout) {
+	const std::string testFile = "write_layout.txt";
+	TxtMethod txt;
+	txt.WriteTxt({ { 123.456, 78.9, 0.123 }, { 9999.99, -5.0, 3.14159 }, {} }, testFile);
+	std::ifstream in(testFile, std::ios::binary);
+	std::stringstream ss;
+	ss << in.rdbuf();
+	EXPECT_EQ(ss.str(), "0123.46 0078.90 0000.12\n9999.99 00-5.00 0003.14\n\n");
+	in.close();
+
+	txt.WriteTxt({ { 1.5, -2.25 } }, testFile, 3);
+	in.open(testFile, std::ios::binary);
+	ss.str("");
+	ss << in.rdbuf();
+	EXPECT_EQ(ss.str(), "0001.500 00-2.250\n");
+	in.close();
+
+	std::string line;
+	const double v[] = { 1.5, -2.25 };
+	TxtMethod::AppendTxtLine(line, v, 2, 0);
+	EXPECT_EQ(line, "0002 00-2\n");
+
+	EXPECT_THROW(txt.WriteTxt({ { 1.0 } }, testFile, -1), std::invalid_argument);
+	EXPECT_THROW(TxtMethod::AppendDouble(line, 1.0, TxtMethod::MaxPrecision + 1), std::invalid_argument);
+	fs::remove(testFile);
+}
+
+// 并行读取与逐个串行读取一致：含段边界恰在换行处、超过段长的行、无结尾换行与无法打开的文件
+TEST(TxtMethodTest, ReadParallelMatchesSerial) {
+	std::vector<std::string> files;
+	std::mt19937 rng(21);
+	std::uniform_real_distribution<double> dist(-1e3, 1e3);
+	for (int f = 0; f < 6; ++f) {
+		files.push_back("read_parallel_" + std::to_string(f) + ".txt");
+		std::ofstream out(files.back(), std::ios::binary);
+		const int rows = (f == 0) ? 0 : 1000 * f;
+		for (int i = 0; i < rows; ++i) {
+			if (i % 333 == 0) {
+				out << std::string(600, ' ') << "1 2 3\n";  // 长行
+			}
+			if (i % 97 == 0) {
+				out << "bad line\n\n";
+			}
+			out << dist(rng) << " " << dist(rng) << " " << dist(rng) << " " << i;
+			if (f != 3 || i + 1 < rows) {
+				out << "\r\n";
+			}
+		}
+	}
+	files.push_back("no_such_file.txt");
+
+	WeldTrackApp::WorkStealingPool pool(3);
+	TxtMethod txt;
+	ColumnSchema schema = ColumnSchema::Point3();
+	schema.Add("count", ColumnType::Int32);
+	for (size_t segmentBytes : { size_t(1), size_t(257), size_t(4096), TxtMethod::ParallelSegmentBytes }) {
+		auto data = txt.ReadDataParallel(files, pool, segmentBytes);
+		auto tables = txt.ReadColumnsParallel(files, schema, pool, segmentBytes);
+		ASSERT_EQ(data.size(), files.size());
+		ASSERT_EQ(tables.size(), files.size());
+		for (size_t f = 0; f < files.size(); ++f) {
+			EXPECT_EQ(data[f], txt.ReadData(files[f])) << files[f] << " " << segmentBytes;
+			ColumnTable expect = txt.ReadColumns(files[f], schema);
+			ASSERT_EQ(tables[f].Rows(), expect.Rows()) << files[f];
+			EXPECT_EQ(tables[f].ToRows(), expect.ToRows()) << files[f] << " " << segmentBytes;
+		}
+	}
+	EXPECT_EQ(txt.ReadDataParallel(files[4], pool, 1024), txt.ReadData(files[4]));
+	EXPECT_EQ(txt.ReadColumnsParallel(files[5], schema, pool, 1024).ToRows(), txt.ReadColumns(files[5], schema).ToRows());
+
+	for (size_t f = 0; f + 1 < files.size(); ++f) {
+		fs::remove(files[f]);
+	}
+}
+
+// 表拼接：列定义不一致时抛出异常
+TEST(TxtMethodTest, ColumnTableAppend) {
+	ColumnTable a(ColumnSchema::IncData());
+	ColumnTable b(ColumnSchema::IncData());
+	a.AppendRow({ 1, 2, 3, 4, 5, 6 });
+	b.AppendRow({ 7, 8, 9, 10, 11, 12 });
+	b.AppendRow({ -1, -2, -3, -4, -5, -6 });
+	a.Append(b);
+	ASSERT_EQ(a.Rows(), 3u);
+	EXPECT_EQ(a.Int32(0), std::vector<int32_t>({ 1, 7, -1 }));
+	EXPECT_THROW(a.Append(ColumnTable(ColumnSchema::Pose6())), std::invalid_argument);
+	EXPECT_THROW(a.Append(ColumnTable(ColumnSchema::Point3())), std::invalid_argument);
+}
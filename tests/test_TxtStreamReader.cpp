@@ -0,0 +1,126 @@
+#include "TxtMethod/TxtStreamReader.h"
+#include "TxtMethod/TxtMethod.h"
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+
+namespace fs = std::filesystem;
+
+// 生成测试文件：每行 [x, y, z, count]，每 50 行插入一行无效数据
+static void MakeLog(const std::string& FileName, int rows) {
+	std::ofstream out(FileName, std::ios::binary);
+	std::mt19937 rng(3);
+	std::uniform_real_distribution<double> dist(-1e3, 1e3);
+	for (int i = 0; i < rows; ++i) {
+		if (i % 50 == 0) {
+			out << "invalid line\n";
+		}
+		out << dist(rng) << " " << dist(rng) << " " << dist(rng) << " " << i << "\n";
+	}
+}
+
+static ColumnSchema LogSchema() {
+	ColumnSchema schema = ColumnSchema::Point3();
+	schema.Add("count", ColumnType::Int32);
+	return schema;
+}
+
+// 按块读取的结果拼接后与 ReadColumns 一致，块大小不超过 chunkRows
+TEST(TxtStreamReaderTest, ChunksMatchReadColumns) {
+	const std::string testFile = "stream_chunks.txt";
+	MakeLog(testFile, 25000);
+	TxtMethod txt;
+	ColumnTable all = txt.ReadColumns(testFile, LogSchema());
+
+	for (size_t readAhead : { 1u, 3u }) {
+		TxtStreamReader reader(testFile, LogSchema(), 1000, readAhead);
+		ColumnTable chunk;
+		size_t row = 0;
+		size_t chunks = 0;
+		while (reader.Next(chunk)) {
+			ASSERT_LE(chunk.Rows(), 1000u);
+			ASSERT_EQ(chunk.Cols(), 4u);
+			for (size_t r = 0; r < chunk.Rows(); ++r, ++row) {
+				for (size_t j = 0; j < 4; ++j) {
+					ASSERT_EQ(chunk.Value(r, j), all.Value(row, j)) << row;
+				}
+			}
+			++chunks;
+		}
+		EXPECT_EQ(row, all.Rows());
+		EXPECT_EQ(reader.RowsRead(), all.Rows());
+		EXPECT_EQ(chunks, 25u);
+		EXPECT_FALSE(reader.Next(chunk));
+	}
+	fs::remove(testFile);
+}
+
+// 逐行遍历与 ReadData 一致
+TEST(TxtStreamReaderTest, RowIterator) {
+	const std::string testFile = "stream_rows.txt";
+	MakeLog(testFile, 3333);
+	TxtMethod txt;
+	auto expect = txt.ReadData(testFile);
+
+	TxtStreamReader reader(testFile, ColumnSchema::Point3(), 256);
+	size_t i = 0;
+	for (const auto& row : reader) {
+		ASSERT_LT(i, expect.size());
+		EXPECT_EQ(row, expect[i]);
+		++i;
+	}
+	EXPECT_EQ(i, expect.size());
+	fs::remove(testFile);
+}
+
+// 空文件与无效参数
+TEST(TxtStreamReaderTest, EmptyAndInvalid) {
+	const std::string testFile = "stream_empty.txt";
+	std::ofstream(testFile).close();
+	{
+		TxtStreamReader reader(testFile);
+		EXPECT_EQ(reader.begin(), reader.end());
+		ColumnTable chunk;
+		EXPECT_FALSE(reader.Next(chunk));
+	}
+	EXPECT_THROW(TxtStreamReader("no_such_file.txt"), std::runtime_error);
+	EXPECT_THROW(TxtStreamReader(testFile, ColumnSchema::Point3(), 0), std::invalid_argument);
+	fs::remove(testFile);
+}
+
+// 未读完即析构：后台线程停止，不阻塞
+TEST(TxtStreamReaderTest, EarlyStop) {
+	const std::string testFile = "stream_stop.txt";
+	MakeLog(testFile, 20000);
+	{
+		TxtStreamReader reader(testFile, ColumnSchema::Point3(), 100, 2);
+		ColumnTable chunk;
+		ASSERT_TRUE(reader.Next(chunk));
+		EXPECT_EQ(chunk.Rows(), 100u);
+	}
+	fs::remove(testFile);
+}
+
+// ReadChunks：回调返回 false 时停止读取
+TEST(TxtStreamReaderTest, ReadChunksStops) {
+	const std::string testFile = "stream_callback.txt";
+	MakeLog(testFile, 1000);
+	TxtMethod txt;
+	size_t calls = 0;
+	size_t rows = 0;
+	EXPECT_TRUE(txt.ReadChunks(testFile, LogSchema(), 300, [&](const ColumnTable& chunk) {
+		++calls;
+		rows += chunk.Rows();
+		return true;
+	}));
+	EXPECT_EQ(calls, 4u);
+	EXPECT_EQ(rows, 1000u);
+
+	calls = 0;
+	txt.ReadChunks(testFile, LogSchema(), 300, [&](const ColumnTable&) { return ++calls < 2; });
+	EXPECT_EQ(calls, 2u);
+	EXPECT_FALSE(txt.ReadChunks("no_such_file.txt", LogSchema(), 300, [](const ColumnTable&) { return true; }));
+	fs::remove(testFile);
+}
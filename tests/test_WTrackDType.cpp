@@ -4,6 +4,7 @@
 void test_enum_sizes() {
     static_assert(sizeof(WeldTrackApp::TcpCommStatus) == sizeof(int), "Enum size mismatch");
     static_assert(sizeof(WeldTrackApp::RobotRecvMsg) == (4 * 8 * 4 + 4 * 4), "Struct size mismatch");
+    static_assert(sizeof(WeldTrackApp::IncPt) == 6 * 4, "Struct size mismatch");
 }
 
 void test_default_values() {